@@ -0,0 +1,269 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+// Struct to hold a running count of allocations and allocated bytes
+struct AllocationCounters
+{
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+};
+
+// Allocations made by the calling thread. Only programs that define YAHTZEE_COUNT_ALLOCATIONS before
+// including this header count them; everywhere else they stay zero and counting costs nothing.
+inline thread_local AllocationCounters thread_allocations;
+
+
+// Whether this program counts allocations
+constexpr bool counts_allocations()
+{
+#ifdef YAHTZEE_COUNT_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+// Struct to hold the allocations of every call of one function or phase
+struct AllocationTally
+{
+    uint64_t calls = 0;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+
+    void merge(const AllocationTally &other)
+    {
+        calls += other.calls;
+        allocations += other.allocations;
+        bytes += other.bytes;
+    }
+
+    double get_allocations_per_call() const
+    {
+        return calls > 0 ? static_cast<double>(allocations) / calls : 0;
+    }
+
+    double get_bytes_per_call() const
+    {
+        return calls > 0 ? static_cast<double>(bytes) / calls : 0;
+    }
+};
+
+
+// Counts the allocations the calling thread makes while the scope is alive as one call of a tally.
+// Scopes nest; an allocation inside an inner scope is counted by every enclosing scope as well.
+class AllocationScope
+{
+public:
+    explicit AllocationScope(AllocationTally &tally) : tally(tally), start(thread_allocations)
+    {
+    }
+
+    AllocationScope(const AllocationScope &) = delete;
+    AllocationScope &operator=(const AllocationScope &) = delete;
+
+    ~AllocationScope()
+    {
+        tally.calls++;
+        tally.allocations += thread_allocations.count - start.count;
+        tally.bytes += thread_allocations.bytes - start.bytes;
+    }
+
+private:
+    AllocationTally &tally;
+    const AllocationCounters start;
+};
+
+
+#ifdef YAHTZEE_COUNT_ALLOCATIONS
+/* *********************************************************************
+Function Name: counted_allocate
+Purpose: To make an allocation for the replaced allocation functions and count it for the calling thread.
+Parameters:
+            size, the number of bytes requested.
+            alignment, the alignment requested; 0 for the default alignment of operator new.
+Return Value: A pointer to the memory, or nullptr if there is not enough memory.
+Algorithm:
+            1) Count the allocation and its bytes.
+            2) Allocate with malloc, or with an aligned allocation whose size is rounded up to a multiple
+               of the alignment when an alignment is given.
+Reference: none
+********************************************************************* */
+inline void *counted_allocate(const size_t size, const size_t alignment) noexcept
+{
+    thread_allocations.count++;
+    thread_allocations.bytes += size;
+    if (alignment == 0)
+    {
+        return malloc(size == 0 ? 1 : size);
+    }
+    const size_t aligned_size = (size + alignment - 1) / alignment * alignment;
+#ifdef _WIN32
+    return _aligned_malloc(aligned_size == 0 ? alignment : aligned_size, alignment);
+#else
+    return aligned_alloc(alignment, aligned_size == 0 ? alignment : aligned_size);
+#endif
+}
+
+
+/* *********************************************************************
+Function Name: counted_release
+Purpose: To free memory made by counted_allocate; every replaced operator delete calls it.
+Parameters:
+            pointer, the memory to free; it may be nullptr.
+            aligned, a boolean. It is true if the memory was allocated with an alignment.
+Return Value: None
+Algorithm:
+            1) Free the memory with the function that matches how it was allocated.
+Reference: none
+********************************************************************* */
+// GCC cannot tell that the replaced operator new allocates with malloc, and flags the free of every
+// inlined delete; the pairing is correct because all of them go through this one function.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+inline void counted_release(void *pointer, const bool aligned) noexcept
+{
+#ifdef _WIN32
+    if (aligned)
+    {
+        _aligned_free(pointer);
+        return;
+    }
+#else
+    (void)aligned;
+#endif
+    free(pointer);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+
+// Replacements of the global allocation functions that count every allocation of the calling thread,
+// including the nothrow and over-aligned forms, so no allocation bypasses the count and every
+// operator delete matches its operator new. They are not inline, so only one translation unit of a
+// program may define YAHTZEE_COUNT_ALLOCATIONS.
+void *operator new(const size_t size)
+{
+    if (void *pointer = counted_allocate(size, 0))
+    {
+        return pointer;
+    }
+    throw bad_alloc();
+}
+
+void *operator new[](const size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(const size_t size, const nothrow_t &) noexcept
+{
+    return counted_allocate(size, 0);
+}
+
+void *operator new[](const size_t size, const nothrow_t &) noexcept
+{
+    return counted_allocate(size, 0);
+}
+
+void *operator new(const size_t size, const align_val_t alignment)
+{
+    if (void *pointer = counted_allocate(size, static_cast<size_t>(alignment)))
+    {
+        return pointer;
+    }
+    throw bad_alloc();
+}
+
+void *operator new[](const size_t size, const align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void *operator new(const size_t size, const align_val_t alignment, const nothrow_t &) noexcept
+{
+    return counted_allocate(size, static_cast<size_t>(alignment));
+}
+
+void *operator new[](const size_t size, const align_val_t alignment, const nothrow_t &) noexcept
+{
+    return counted_allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void *pointer) noexcept
+{
+    counted_release(pointer, false);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    counted_release(pointer, false);
+}
+
+void operator delete(void *pointer, size_t) noexcept
+{
+    counted_release(pointer, false);
+}
+
+void operator delete[](void *pointer, size_t) noexcept
+{
+    counted_release(pointer, false);
+}
+
+void operator delete(void *pointer, const nothrow_t &) noexcept
+{
+    counted_release(pointer, false);
+}
+
+void operator delete[](void *pointer, const nothrow_t &) noexcept
+{
+    counted_release(pointer, false);
+}
+
+void operator delete(void *pointer, align_val_t) noexcept
+{
+    counted_release(pointer, true);
+}
+
+void operator delete[](void *pointer, align_val_t) noexcept
+{
+    counted_release(pointer, true);
+}
+
+void operator delete(void *pointer, size_t, align_val_t) noexcept
+{
+    counted_release(pointer, true);
+}
+
+void operator delete[](void *pointer, size_t, align_val_t) noexcept
+{
+    counted_release(pointer, true);
+}
+
+void operator delete(void *pointer, align_val_t, const nothrow_t &) noexcept
+{
+    counted_release(pointer, true);
+}
+
+void operator delete[](void *pointer, align_val_t, const nothrow_t &) noexcept
+{
+    counted_release(pointer, true);
+}
+#endif
@@ -0,0 +1,456 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "Hand.h"
+#include "ScoreTable.h"
+
+using namespace std;
+
+// Five-dice rolls in structure-of-arrays form: dice[d][h] is the face (1 to 6) of die d of roll h,
+// in the order the dice were rolled
+struct DiceBatch
+{
+    array<vector<uint8_t>, 5> dice;
+
+    size_t size() const
+    {
+        return dice[0].size();
+    }
+
+    void add(const array<uint8_t, 5> &roll)
+    {
+        for (int d = 0; d < 5; d++)
+        {
+            dice[d].push_back(roll[d]);
+        }
+    }
+};
+
+// Five-dice hands in structure-of-arrays form: counts[f - 1][h] is how many dice of hand h show face f
+struct FaceCountBatch
+{
+    array<vector<uint8_t>, 6> counts;
+
+    size_t size() const
+    {
+        return counts[0].size();
+    }
+
+    void add(const Hand &hand)
+    {
+        for (int face = 1; face <= 6; face++)
+        {
+            counts[face - 1].push_back(static_cast<uint8_t>(hand.count(face)));
+        }
+    }
+};
+
+// Scores of a batch of hands in structure-of-arrays form: scores[c][h] is hand h's score in
+// Category(c + 1)
+struct BatchScores
+{
+    array<vector<uint8_t>, NUM_CATEGORIES> scores;
+};
+
+
+// One hand per step, for the hands left over after the last full vector
+struct ScalarLanes
+{
+    using Vector = uint8_t;
+    static constexpr size_t WIDTH = 1;
+
+    static Vector load(const uint8_t *source)
+    {
+        return *source;
+    }
+
+    static void store(uint8_t *destination, const Vector value)
+    {
+        *destination = value;
+    }
+
+    static Vector broadcast(const uint8_t value)
+    {
+        return value;
+    }
+
+    static Vector add(const Vector a, const Vector b)
+    {
+        return static_cast<uint8_t>(a + b);
+    }
+
+    static Vector max(const Vector a, const Vector b)
+    {
+        return a > b ? a : b;
+    }
+
+    // Comparisons give a mask lane: all ones when true, zero when false
+    static Vector equal(const Vector a, const Vector b)
+    {
+        return a == b ? 0xFF : 0;
+    }
+
+    static Vector greater(const Vector a, const Vector b)
+    {
+        return a > b ? 0xFF : 0;
+    }
+
+    static Vector bit_and(const Vector a, const Vector b)
+    {
+        return a & b;
+    }
+
+    static Vector bit_or(const Vector a, const Vector b)
+    {
+        return a | b;
+    }
+};
+
+#ifdef __SSE2__
+// 16 hands per step in the byte lanes of an SSE2 register. Every value stays below 128, so the
+// signed byte comparison is exact.
+struct Sse2Lanes
+{
+    using Vector = __m128i;
+    static constexpr size_t WIDTH = 16;
+
+    static Vector load(const uint8_t *source)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+    }
+
+    static void store(uint8_t *destination, const Vector value)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), value);
+    }
+
+    static Vector broadcast(const uint8_t value)
+    {
+        return _mm_set1_epi8(static_cast<char>(value));
+    }
+
+    static Vector add(const Vector a, const Vector b)
+    {
+        return _mm_add_epi8(a, b);
+    }
+
+    static Vector max(const Vector a, const Vector b)
+    {
+        return _mm_max_epu8(a, b);
+    }
+
+    static Vector equal(const Vector a, const Vector b)
+    {
+        return _mm_cmpeq_epi8(a, b);
+    }
+
+    static Vector greater(const Vector a, const Vector b)
+    {
+        return _mm_cmpgt_epi8(a, b);
+    }
+
+    static Vector bit_and(const Vector a, const Vector b)
+    {
+        return _mm_and_si128(a, b);
+    }
+
+    static Vector bit_or(const Vector a, const Vector b)
+    {
+        return _mm_or_si128(a, b);
+    }
+};
+#endif
+
+#ifdef __AVX2__
+// 32 hands per step in the byte lanes of an AVX2 register
+struct Avx2Lanes
+{
+    using Vector = __m256i;
+    static constexpr size_t WIDTH = 32;
+
+    static Vector load(const uint8_t *source)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+    }
+
+    static void store(uint8_t *destination, const Vector value)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), value);
+    }
+
+    static Vector broadcast(const uint8_t value)
+    {
+        return _mm256_set1_epi8(static_cast<char>(value));
+    }
+
+    static Vector add(const Vector a, const Vector b)
+    {
+        return _mm256_add_epi8(a, b);
+    }
+
+    static Vector max(const Vector a, const Vector b)
+    {
+        return _mm256_max_epu8(a, b);
+    }
+
+    static Vector equal(const Vector a, const Vector b)
+    {
+        return _mm256_cmpeq_epi8(a, b);
+    }
+
+    static Vector greater(const Vector a, const Vector b)
+    {
+        return _mm256_cmpgt_epi8(a, b);
+    }
+
+    static Vector bit_and(const Vector a, const Vector b)
+    {
+        return _mm256_and_si256(a, b);
+    }
+
+    static Vector bit_or(const Vector a, const Vector b)
+    {
+        return _mm256_or_si256(a, b);
+    }
+};
+#endif
+
+// The widest lanes this build can use; build with -mavx2 (or -march=native) for 32 hands per step
+#if defined(__AVX2__)
+using WideLanes = Avx2Lanes;
+#elif defined(__SSE2__)
+using WideLanes = Sse2Lanes;
+#else
+using WideLanes = ScalarLanes;
+#endif
+
+
+// The count of every face for one vector of hands, count[f - 1] for face f
+template <typename Lanes>
+struct LaneCounts
+{
+    typename Lanes::Vector count[6];
+};
+
+
+// Scores many five-dice hands at once. Every step loads one vector of hands per input lane and
+// computes all 12 category scores with byte-wise adds, compares and masks, with no branches and no
+// table lookups, so each step scores WideLanes::WIDTH hands. The scores equal get_score's.
+class BatchScorer
+{
+public:
+    // Name of the instruction set the batch kernel was compiled for
+    static const char *get_instruction_set()
+    {
+#if defined(__AVX2__)
+        return "AVX2";
+#elif defined(__SSE2__)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+
+/* *********************************************************************
+Function Name: score
+Purpose: To score a batch of hands given as face counts.
+Parameters:
+            hands, a FaceCountBatch passed by reference.
+            scores, a BatchScores passed by reference. Its columns are resized to the batch and filled.
+Return Value: None
+Algorithm:
+            1) Score full vectors of hands with the widest lanes, then the rest one hand at a time.
+Reference: none
+********************************************************************* */
+    static void score(const FaceCountBatch &hands, BatchScores &scores)
+    {
+        const size_t num_hands = hands.size();
+        array<uint8_t *, NUM_CATEGORIES> out = get_columns(scores, num_hands);
+
+        size_t h = 0;
+        for (; h + WideLanes::WIDTH <= num_hands; h += WideLanes::WIDTH)
+        {
+            score_counts<WideLanes>(load_counts<WideLanes>(hands, h), out, h);
+        }
+        for (; h < num_hands; h++)
+        {
+            score_counts<ScalarLanes>(load_counts<ScalarLanes>(hands, h), out, h);
+        }
+    }
+
+
+/* *********************************************************************
+Function Name: score
+Purpose: To score a batch of rolls given as the faces of their five dice.
+Parameters:
+            rolls, a DiceBatch passed by reference.
+            scores, a BatchScores passed by reference. Its columns are resized to the batch and filled.
+Return Value: None
+Algorithm:
+            1) For full vectors of rolls, then the rest one roll at a time, count every face in
+               registers and score the counts.
+Reference: none
+********************************************************************* */
+    static void score(const DiceBatch &rolls, BatchScores &scores)
+    {
+        const size_t num_rolls = rolls.size();
+        array<uint8_t *, NUM_CATEGORIES> out = get_columns(scores, num_rolls);
+
+        size_t h = 0;
+        for (; h + WideLanes::WIDTH <= num_rolls; h += WideLanes::WIDTH)
+        {
+            score_counts<WideLanes>(count_faces<WideLanes>(rolls, h), out, h);
+        }
+        for (; h < num_rolls; h++)
+        {
+            score_counts<ScalarLanes>(count_faces<ScalarLanes>(rolls, h), out, h);
+        }
+    }
+
+
+private:
+    static array<uint8_t *, NUM_CATEGORIES> get_columns(BatchScores &scores, const size_t size)
+    {
+        array<uint8_t *, NUM_CATEGORIES> columns;
+        for (int c = 0; c < NUM_CATEGORIES; c++)
+        {
+            scores.scores[c].resize(size);
+            columns[c] = scores.scores[c].data();
+        }
+        return columns;
+    }
+
+    template <typename Lanes>
+    static LaneCounts<Lanes> load_counts(const FaceCountBatch &hands, const size_t h)
+    {
+        LaneCounts<Lanes> counts;
+        for (int f = 0; f < 6; f++)
+        {
+            counts.count[f] = Lanes::load(hands.counts[f].data() + h);
+        }
+        return counts;
+    }
+
+
+/* *********************************************************************
+Function Name: count_faces
+Purpose: To turn the dice of a vector of rolls into face counts.
+Parameters:
+            rolls, a DiceBatch passed by reference.
+            h, an index. It is the first roll of the vector.
+Return Value: The count of every face, one vector per face.
+Algorithm:
+            1) For every face, add up the masks of the dice that show it, each masked down to 1.
+Reference: none
+********************************************************************* */
+    template <typename Lanes>
+    static LaneCounts<Lanes> count_faces(const DiceBatch &rolls, const size_t h)
+    {
+        using Vector = typename Lanes::Vector;
+        Vector dice[5];
+        for (int d = 0; d < 5; d++)
+        {
+            dice[d] = Lanes::load(rolls.dice[d].data() + h);
+        }
+
+        const Vector one = Lanes::broadcast(1);
+        LaneCounts<Lanes> counts;
+        for (int f = 0; f < 6; f++)
+        {
+            const Vector face = Lanes::broadcast(static_cast<uint8_t>(f + 1));
+            Vector count = Lanes::broadcast(0);
+            for (int d = 0; d < 5; d++)
+            {
+                count = Lanes::add(count, Lanes::bit_and(Lanes::equal(dice[d], face), one));
+            }
+            counts.count[f] = count;
+        }
+        return counts;
+    }
+
+
+/* *********************************************************************
+Function Name: score_counts
+Purpose: To compute the 12 category scores of a vector of hands from their face counts.
+Parameters:
+            counts, the count of every face, one vector per face.
+            out, the 12 score columns.
+            h, an index. It is the first hand of the vector.
+Return Value: None
+Algorithm:
+            1) Ones to Sixes: multiply each count by its face with adds; their total is the dice sum.
+            2) Three/Four of a Kind: the sum, masked by the largest count being at least 3/4.
+            3) Full House: 25, masked by some count being 3 and some count being 2.
+            4) Four/Five Straight: 30/40, masked by 4/5 consecutive faces being present.
+            5) Yahtzee: 50, masked by the largest count being 5.
+Reference: none
+********************************************************************* */
+    template <typename Lanes>
+    static void score_counts(const LaneCounts<Lanes> &counts,
+                             const array<uint8_t *, NUM_CATEGORIES> &out, const size_t h)
+    {
+        using Vector = typename Lanes::Vector;
+        const Vector zero = Lanes::broadcast(0);
+        const Vector two = Lanes::broadcast(2);
+        const Vector three = Lanes::broadcast(3);
+
+        Vector upper[6];
+        Vector present[6];
+        Vector total = zero;
+        Vector max_count = zero;
+        Vector has_two = zero;
+        Vector has_three = zero;
+        for (int f = 0; f < 6; f++)
+        {
+            const Vector count = counts.count[f];
+            const Vector twice = Lanes::add(count, count);
+            const Vector four_times = Lanes::add(twice, twice);
+            const Vector multiples[6] = {count, twice, Lanes::add(twice, count), four_times,
+                                         Lanes::add(four_times, count), Lanes::add(four_times, twice)};
+            upper[f] = multiples[f];
+            present[f] = Lanes::greater(count, zero);
+
+            total = Lanes::add(total, upper[f]);
+            max_count = Lanes::max(max_count, count);
+            has_two = Lanes::bit_or(has_two, Lanes::equal(count, two));
+            has_three = Lanes::bit_or(has_three, Lanes::equal(count, three));
+        }
+
+        const Vector middle = Lanes::bit_and(Lanes::bit_and(present[1], present[2]), present[3]);
+        const Vector low_four = Lanes::bit_and(present[0], middle);
+        const Vector mid_four = Lanes::bit_and(middle, present[4]);
+        const Vector high_four = Lanes::bit_and(Lanes::bit_and(present[2], present[3]),
+                                                Lanes::bit_and(present[4], present[5]));
+        const Vector four_straight = Lanes::bit_or(Lanes::bit_or(low_four, mid_four), high_four);
+        const Vector five_straight = Lanes::bit_or(Lanes::bit_and(low_four, present[4]),
+                                                   Lanes::bit_and(mid_four, present[5]));
+
+        for (int f = 0; f < 6; f++)
+        {
+            Lanes::store(out[f] + h, upper[f]);
+        }
+        Lanes::store(out[6] + h, Lanes::bit_and(total, Lanes::greater(max_count, two)));
+        Lanes::store(out[7] + h, Lanes::bit_and(total, Lanes::greater(max_count, three)));
+        Lanes::store(out[8] + h, Lanes::bit_and(Lanes::broadcast(25), Lanes::bit_and(has_two, has_three)));
+        Lanes::store(out[9] + h, Lanes::bit_and(Lanes::broadcast(30), four_straight));
+        Lanes::store(out[10] + h, Lanes::bit_and(Lanes::broadcast(40), five_straight));
+        Lanes::store(out[11] + h, Lanes::bit_and(Lanes::broadcast(50), Lanes::equal(max_count, Lanes::broadcast(5))));
+    }
+};
@@ -0,0 +1,223 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+#include "Crc32.h"
+#include "ScoreCard.h"
+
+using namespace std;
+
+// Size in bytes of one binary saved game
+constexpr size_t BINARY_SAVE_SIZE = 32;
+
+// Compact binary form of a saved game, the binary counterpart of Game::serialize.
+// All multi-byte values are little-endian:
+//     bytes 0-1    magic "YZ"
+//     byte  2      format version
+//     byte  3      current round (1 to 255)
+//     bytes 4-27   one 16-bit entry per category, Ones first:
+//                      bits 0-5 points, bits 6-7 winner (0 open, 1 first player, 2 second player),
+//                      bits 8-15 round; an open category is all zero
+//     bytes 28-31  CRC-32 of bytes 0-27
+// Encoding and decoding work on caller-provided buffers and never allocate.
+class BinarySave
+{
+public:
+    static constexpr uint8_t MAGIC[2] = {'Y', 'Z'};
+    static constexpr uint8_t VERSION = 1;
+
+/* *********************************************************************
+Function Name: is_binary_save
+Purpose: To check whether some bytes start like a binary saved game.
+Parameters:
+            data, a pointer to the bytes.
+            size, the number of bytes.
+Return Value: true if the bytes begin with the binary save magic, false otherwise.
+Algorithm:
+            1) Compare the first two bytes with the magic.
+Reference: none
+********************************************************************* */
+    static bool is_binary_save(const uint8_t *data, const size_t size)
+    {
+        return size >= 2 && data[0] == MAGIC[0] && data[1] == MAGIC[1];
+    }
+
+
+/* *********************************************************************
+Function Name: has_valid_checksum
+Purpose: To check that a binary saved game was not corrupted.
+Parameters:
+            data, a pointer to BINARY_SAVE_SIZE bytes.
+Return Value: true if the stored CRC-32 matches the bytes before it, false otherwise.
+Algorithm:
+            1) Compare the stored checksum with the CRC-32 of everything before it.
+Reference: none
+********************************************************************* */
+    static bool has_valid_checksum(const uint8_t *data)
+    {
+        return read_uint32(data + CRC_OFFSET) == crc32(data, CRC_OFFSET);
+    }
+
+
+/* *********************************************************************
+Function Name: is_valid_entry
+Purpose: To check one packed category entry of a binary saved game.
+Parameters:
+            packed, an unsigned 16-bit integer. It is the entry: points in bits 0-5, winner in bits 6-7
+            (0 for an open category, 1 and 2 for the players) and round in bits 8-15.
+Return Value: true if the entry is an open category with no data, or a filled one with a player,
+              0 to 50 points and a round, false otherwise.
+Algorithm:
+            1) An open category must be all zero.
+            2) A filled one must name player 1 or 2, hold at most 50 points and a round other than 0.
+Reference: none
+********************************************************************* */
+    static bool is_valid_entry(const uint16_t packed)
+    {
+        const int winner = (packed >> 6) & 0x3;
+        if (winner == 0)
+        {
+            return packed == 0;
+        }
+        return winner != 3 && (packed & 0x3F) <= 50 && (packed >> 8) != 0;
+    }
+
+
+/* *********************************************************************
+Function Name: encode
+Purpose: To write a scorecard and round as a binary saved game.
+Parameters:
+            score_card, a ScoreCard passed by reference. It is the state to save.
+            round, an integer from 1 to 255. It is the current round.
+            out, a pointer to BINARY_SAVE_SIZE bytes. It receives the encoded game.
+Return Value: None
+Algorithm:
+            1) Write the magic, the version and the round.
+            2) Pack every category into 16 bits; throw if a value does not fit; player indices 0 and 1 are
+               stored as winners 1 and 2.
+            3) Append the CRC-32 of everything before it.
+Reference: none
+********************************************************************* */
+    static void encode(const ScoreCard &score_card, const int round, uint8_t *out)
+    {
+        if (round < 1 || round > 255)
+        {
+            throw invalid_argument("Round does not fit in a binary save");
+        }
+
+        out[0] = MAGIC[0];
+        out[1] = MAGIC[1];
+        out[2] = VERSION;
+        out[3] = static_cast<uint8_t>(round);
+
+        for (int i = 0; i < NUM_CATEGORIES; i++)
+        {
+            const optional<ScoreCardEntry> entry = score_card.get_entry(static_cast<Category>(i + 1));
+            uint16_t packed = 0;
+            if (entry.has_value())
+            {
+                const ScoreCardEntry &value = entry.value();
+                if (value.points < 0 || value.points > 63 || value.round < 1 || value.round > 255)
+                {
+                    throw invalid_argument("Score card entry does not fit in a binary save");
+                }
+                const uint16_t winner = static_cast<uint16_t>(value.player + 1);
+                packed = static_cast<uint16_t>(value.points | (winner << 6) | (value.round << 8));
+            }
+            out[4 + 2 * i] = static_cast<uint8_t>(packed);
+            out[5 + 2 * i] = static_cast<uint8_t>(packed >> 8);
+        }
+
+        write_uint32(out + CRC_OFFSET, crc32(out, CRC_OFFSET));
+    }
+
+
+/* *********************************************************************
+Function Name: decode
+Purpose: To read a binary saved game back into a scorecard and round.
+Parameters:
+            data, a pointer to the encoded bytes.
+            size, the number of bytes; it must be BINARY_SAVE_SIZE.
+            round, an integer passed by reference. It receives the saved round.
+Return Value: The saved ScoreCard.
+Algorithm:
+            1) Throw if the size, magic, version or checksum is wrong.
+            2) Unpack every category, throwing on a winner of 3, stray bits in an open category, more
+               than 50 points or round 0.
+            3) Add every filled category to an empty scorecard.
+Reference: none
+********************************************************************* */
+    static ScoreCard decode(const uint8_t *data, const size_t size, int &round)
+    {
+        if (size != BINARY_SAVE_SIZE)
+        {
+            throw runtime_error("Binary save has the wrong size");
+        }
+        if (!is_binary_save(data, size))
+        {
+            throw runtime_error("Binary save has the wrong magic");
+        }
+        if (data[2] != VERSION)
+        {
+            throw runtime_error("Binary save has an unsupported version");
+        }
+        if (!has_valid_checksum(data))
+        {
+            throw runtime_error("Binary save is corrupt (checksum mismatch)");
+        }
+        if (data[3] == 0)
+        {
+            throw runtime_error("Binary save has round 0");
+        }
+
+        ScoreCard score_card;
+        for (int i = 0; i < NUM_CATEGORIES; i++)
+        {
+            const uint16_t packed = static_cast<uint16_t>(data[4 + 2 * i] | (data[5 + 2 * i] << 8));
+            const int winner = (packed >> 6) & 0x3;
+            if (!is_valid_entry(packed))
+            {
+                throw runtime_error(winner == 0 ? "Binary save has data in an open category"
+                                                : "Binary save has an invalid entry");
+            }
+            if (winner == 0)
+            {
+                continue;
+            }
+            score_card = score_card.add_entry(static_cast<Category>(i + 1), packed & 0x3F, winner - 1, packed >> 8);
+        }
+
+        round = data[3];
+        return score_card;
+    }
+
+
+private:
+    // Offset of the checksum, which covers every byte before it
+    static constexpr size_t CRC_OFFSET = BINARY_SAVE_SIZE - 4;
+
+    static void write_uint32(uint8_t *out, const uint32_t value)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            out[i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+    }
+
+    static uint32_t read_uint32(const uint8_t *data)
+    {
+        return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+               (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+    }
+};
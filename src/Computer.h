@@ -7,8 +7,29 @@
 *****************************************************************
 */
 #pragma once
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
 #include "Player.h"
+#include "PolicyTable.h"
+#include "RerollTable.h"
 #include "ScoreCard.h"
+#include "Trace.h"
+#include "TurnSolver.h"
+
+// Struct to hold the category pursuits computed so far, keyed by kept-hand index and open mask.
+// There are up to 462 x 4096 keys of up to 12 Reasons each, about 2 GB in all, so the cache is
+// cleared whenever it reaches MAX_ENTRIES (about 64 MB). Callers share ownership of the entries,
+// so clearing never invalidates a map still in use.
+struct PursuitCache
+{
+    static constexpr size_t MAX_ENTRIES = 1 << 16;
+
+    shared_mutex cache_mutex;
+    unordered_map<uint32_t, shared_ptr<const map<Category, Reason>>> pursuits;
+};
 
 class Computer : public Player
 {
@@ -17,19 +38,25 @@ public:
     Computer() : Player("Computer")
     {
     }
+
+    // Constructor: Initialize the player with a custom name, used when several computers play each other
+    explicit Computer(const string &name) : Player(name)
+    {
+    }
+
 /* *********************************************************************
 Function Name: get_dice_roll
 Purpose: To handle the dice roll for the computer's turn
 Parameters:
             num_dice, an integer. It refers to the number of dice to roll
-Return Value: A vector of integers representing the rolled dice values
+Return Value: A Hand holding the rolled dice values
 Algorithm:
             1) Check if human wants to manually input the dice roll
             2) If yes, call the Player's get_dice_roll function
-            3) If no, roll the dice using Dice::roll_dice and return the result
+            3) If no, roll the dice using Dice::roll_hand and return the result
 Reference: none
 ********************************************************************* */
-    vector<int> get_dice_roll(const int num_dice) override
+    Hand get_dice_roll(const int num_dice) override
     {
 
         // Optionally allow the human to manually input dice rolls for testing
@@ -38,170 +65,130 @@ Reference: none
         {
             return Player::get_dice_roll(num_dice);
         }
-        auto roll = Dice::roll_dice(num_dice);
-        return roll;
+        return Dice::roll_hand(num_dice);
     }
 
 /* *********************************************************************
 Function Name: generate_possible_final_rolls
 Purpose: To generate all possible final rolls based on the kept dice
 Parameters:
-           kept_dice, a vector of integers representing the dice kept
-Return Value: A vector of vectors of integers representing all possible final rolls
+           kept_dice, a Hand holding the dice kept
+Return Value: A vector of Hands representing all possible final rolls
 Algorithm:
-           1) Generate all possible rolls based on the current dice size
-           2) Merge kept dice with each generated roll
-           3) Sort each final roll and store the results
+           1) Look the outcomes of rolling the dice that are not kept up in the reroll table
+           2) Store the final hand of each outcome
 Reference: none
 ********************************************************************* */
-    static vector<vector<int>> generate_possible_final_rolls(const vector<int> &kept_dice)
+    static vector<Hand> generate_possible_final_rolls(const Hand &kept_dice)
     {
-        // Generate all possible rolls based on the current dice size
-        auto possible_rolls = dice_combinations(5 - kept_dice.size());
+        const RerollOutcomes outcomes = get_reroll_outcomes(kept_dice);
 
-        // Prepare the possible final rolls by merging kept dice and possible rolls
-        vector<vector<int>> possible_final_rolls;
-        possible_final_rolls.reserve(possible_rolls.size()); // Reserve memory to avoid resizing
+        vector<Hand> possible_final_rolls;
+        possible_final_rolls.reserve(outcomes.size()); // Reserve memory to avoid resizing
 
-        // Merge kept dice with each generated roll, then sort and store the results
-        for (const auto &roll : possible_rolls)
+        for (const RerollOutcome &outcome : outcomes)
         {
-            auto final_roll = concatenate(kept_dice, roll);
-            sort(final_roll.begin(), final_roll.end());
-            possible_final_rolls.push_back(final_roll);
+            possible_final_rolls.push_back(outcome.final_hand);
         }
 
         return possible_final_rolls;
     }
 
 /* *********************************************************************
-Function Name: calculate_scores
-Purpose: To calculate scores for all possible final rolls based on open categories
+Function Name: get_max_open_score
+Purpose: To get the highest score of a five-dice roll in any open category
 Parameters:
-            final_rolls, a vector of vectors of integers representing final rolls
-            score_card, a ScoreCard object containing the current game state
-Return Value: A vector of pairs containing final rolls and their corresponding scores
+            final_roll, a Hand of five dice
+            open_mask, a 12-bit category mask holding the categories that are not filled yet
+Return Value: The highest score of the roll over the open categories, or -1 if none is open
 Algorithm:
-            1) Get open categories from the score card
-            2) For each possible roll, calculate its score for each open category
-            3) Store each roll and its score in the scores vector
-            4) Sort scores in descending order of score
-     Reference: none
+            1) Read the roll's scores from the score table
+            2) Keep the highest score whose category bit is set in the open mask
+Reference: none
 ********************************************************************* */
-    static vector<pair<vector<int>, int>> calculate_scores(const vector<vector<int>> &final_rolls,
-                                                           const ScoreCard &score_card)
+    static int get_max_open_score(const Hand &final_roll, const uint16_t open_mask)
     {
-
-        // Store roll and its corresponding score
-        vector<pair<vector<int>, int>> scores;
-
-        // Get unfilled categories
-        auto open_categories = score_card.get_open_categories();
-
-        // For each possible roll, calculate its score for each open category
-        for (const auto &final_roll : final_rolls)
+        const HandScores &hand_scores = HAND_SCORES[final_roll.id()];
+        int max_score = -1;
+        for (int i = 0; i < NUM_CATEGORIES; i++)
         {
-            for (const auto &category : open_categories)
-            {
-                int score = get_score(final_roll, category);
-                // appends a pair (containing final_roll and score) to the scores vector.
-                scores.emplace_back(final_roll, score);
-            }
+            // Closed categories count as -1, without a branch
+            const int open = (open_mask >> i) & 1;
+            max_score = max(max_score, ((hand_scores.scores[i] + 1) & -open) - 1);
         }
-
-        // Sort scores in descending order of score
-        sort(scores.begin(), scores.end(), [](const pair<vector<int>, int> &a, const pair<vector<int>, int> &b)
-             { return a.second > b.second; });
-
-        return scores;
+        return max_score;
     }
 
 /***********************************************************************
 Function Name: find_best_roll
 Purpose: To find the best roll by maximizing score and minimizing the difference from the current roll
 Parameters:
-            scores, a vector of pairs containing rolls and their corresponding scores
-            dice_rolls, a vector of integers representing the current dice rolls
-Return Value: A vector of integers representing the best roll
+            outcomes, the outcomes of rolling the dice that are not kept
+            open_mask, a 12-bit category mask holding the categories that are not filled yet
+            dice_rolls, a Hand holding the current dice rolls
+Return Value: A Hand representing the best roll
 Algorithm:
-            1) Initialize max_score with the score of the first roll
-            2) Iterate over all scores to find the best roll with minimal dice difference
-            3) Return the roll that has the highest score and the least difference from current rolls
+            1) Walk the outcomes once, scoring each final roll in its best open category
+            2) Take a roll when its score is higher than the best so far, or equal with fewer dice
+               different from the current rolls
+            3) Return the best roll; on a full tie the earliest outcome wins
 Reference: none
 ********************************************************************* */
-    static vector<int> find_best_roll(const vector<pair<vector<int>, int>> &scores, const vector<int> &dice_rolls)
+    static Hand find_best_roll(const RerollOutcomes &outcomes, const uint16_t open_mask, const Hand &dice_rolls)
     {
-        int max_score = scores[0].second;
-        vector<int> best_roll = scores[0].first;
-        int best_roll_diff_size = difference(best_roll, dice_rolls).size();
+        Hand best_roll = outcomes.begin()->final_hand;
+        int max_score = -1;
+        int best_roll_diff_size = numeric_limits<int>::max();
 
-        // Iterate over all scores to find the best roll with minimal dice difference
-        for (const auto &[roll, score] : scores)
+        for (const RerollOutcome &outcome : outcomes)
         {
-            // Exit early if the score is lower than the max score
+            const int score = get_max_open_score(outcome.final_hand, open_mask);
             if (score < max_score)
-                break;
+                continue;
 
-            auto roll_diff = difference(roll, dice_rolls);
-            if (roll_diff.size() < best_roll_diff_size)
+            const int roll_diff_size = outcome.final_hand.difference(dice_rolls).size();
+            if (score > max_score || roll_diff_size < best_roll_diff_size)
             {
-                best_roll = roll;
-                best_roll_diff_size = roll_diff.size();
+                best_roll = outcome.final_hand;
+                max_score = score;
+                best_roll_diff_size = roll_diff_size;
             }
         }
 
         return best_roll;
     }
 
-/***********************************************************************
-Function Name: determine_dice_to_keep
-Purpose: To determine which dice to keep based on the best roll
+/*********************************************************************
+Function Name: get_best_roll
+Purpose: To find the best roll the computer should aim for based on the scorecard and kept dice
 Parameters:
-            best_roll, a vector of integers representing the best roll
-            dice_rolls, a vector of integers representing the current dice rolls
-            kept_dice, a vector of integers representing the dice kept from previous rolls
-Return Value: A vector of integers representing the dice to keep for the next roll
+            score_card, a ScoreCard object containing the current game state
+            kept_dice, a Hand holding the dice kept
+Return Value: A Hand representing the best roll
 Algorithm:
-            1) Identify dice needed to complete the best roll
-            2) Return only the dice that match the current roll
+            1) Find the best roll for the open categories of the scorecard
 Reference: none
 ********************************************************************* */
-    static vector<int> determine_dice_to_keep(const vector<int> &best_roll, const vector<int> &dice_rolls,
-                                              const vector<int> &kept_dice)
+    static Hand get_best_roll(const ScoreCard &score_card, const Hand &kept_dice)
     {
-        // Identify dice needed to complete the best roll
-        vector<int> dice_needed = difference(best_roll, kept_dice);
-
-        // Return only the dice that match the current roll
-        return intersection(dice_needed, dice_rolls);
+        return get_best_roll(score_card.get_open_mask(), kept_dice);
     }
 
 /*********************************************************************
 Function Name: get_best_roll
-Purpose: To find the best roll the computer should aim for based on the scorecard and kept dice
+Purpose: To find the best roll to aim for given the open categories and kept dice
 Parameters:
-            score_card, a ScoreCard object containing the current game state
-            kept_dice, a vector of integers representing the dice kept
-Return Value: A vector of integers representing the best roll
+            open_mask, a 12-bit category mask holding the categories that are not filled yet
+            kept_dice, a Hand holding the dice kept
+Return Value: A Hand representing the best roll
 Algorithm:
-            1) Generate possible final rolls
-            2) Calculate scores for all possible final rolls
-            3) Find the best roll with the highest score and minimal difference
+            1) Look the possible final rolls up in the reroll table
+            2) Find the best roll with the highest score and minimal difference
 Reference: none
 ********************************************************************* */
-    static vector<int> get_best_roll(const ScoreCard &score_card, const vector<int> &kept_dice)
+    static Hand get_best_roll(const uint16_t open_mask, const Hand &kept_dice)
     {
-
-        // Step 1: Generate possible final rolls
-        auto possible_final_rolls = generate_possible_final_rolls(kept_dice);
-
-        // Step 2: Calculate scores for all possible final rolls
-        auto scores = calculate_scores(possible_final_rolls, score_card);
-
-        // Step 3: Find the best roll with the highest score and minimal difference
-        auto best_roll = find_best_roll(scores, kept_dice);
-
-        return best_roll;
+        return find_best_roll(get_reroll_outcomes(kept_dice), open_mask, kept_dice);
     }
 
 /**********************************************************************
@@ -209,59 +196,26 @@ Function Name: get_dice_to_keep
 Purpose: To determine which dice to keep for the next roll
 Parameters:
         score_card, a ScoreCard object containing the current game state
-        dice_rolls, a vector of integers representing the current dice rolls
-        kept_dice, a vector of integers representing the dice kept
-Return Value: A vector of integers representing the dice to keep for the next roll
+        dice_rolls, a Hand holding the current dice rolls
+        kept_dice, a Hand holding the dice kept
+        rolls_left, an integer. It is the number of rolls still allowed after this one
+Return Value: A Hand holding the dice to keep for the next roll
 Algorithm:
-           1) Concatenate kept_dice and dice_rolls to get final_roll
-           2) Check for specific categories and handle them accordingly
-           3) Generate possible final rolls
-           4) Calculate scores for all possible final rolls
-           5) Find the best roll and determine which dice to keep
-Reference: ChatGPT for brainstorming and correcting the function.
+           1) Get the open categories of the scorecard as a bitmask
+           2) If a policy table is loaded, look the decision up in it
+           3) Otherwise let the turn solver pick the dice that maximize the expected final score
+Reference: none
    ********************************************************************* */
-    vector<int> get_dice_to_keep(const ScoreCard &score_card, const vector<int> &dice_rolls,
-                                 const vector<int> &kept_dice) override
+    Hand get_dice_to_keep(const ScoreCard &score_card, const Hand &dice_rolls, const Hand &kept_dice,
+                          const int rolls_left) override
     {
-
-        // Step 0:
-        vector<int> final_roll = concatenate(kept_dice, dice_rolls);
-        auto open_categories = score_card.get_open_categories();
-        if (contains(open_categories, Category::Yahtzee) && is_applicable_category(final_roll, Category::Yahtzee))
+        TRACE_SPAN("Computer::get_dice_to_keep");
+        const uint16_t open_mask = score_card.get_open_mask();
+        if (const PolicyTable *policy = PolicyTable::loaded())
         {
-            return dice_rolls;
-        }
-        if (contains(open_categories, Category::FiveStraight))
-        {
-            auto unique_dice = get_unique(dice_rolls);
-            final_roll = concatenate(kept_dice, unique_dice);
-            if (is_applicable_category(final_roll, Category::FiveStraight))
-            {
-                return unique_dice;
-            }
+            return policy->get_dice_to_keep(open_mask, kept_dice, dice_rolls, rolls_left);
         }
-        if (contains(open_categories, Category::FourStraight))
-        {
-            auto unique_dice = get_unique(dice_rolls);
-            final_roll = concatenate(kept_dice, unique_dice);
-            if (is_applicable_category(final_roll, Category::FourStraight))
-            {
-                return unique_dice;
-            }
-        }
-        // Step 1: Generate possible final rolls
-        auto possible_final_rolls = generate_possible_final_rolls(kept_dice);
-
-        // Step 2: Calculate scores for all possible final rolls
-        auto scores = calculate_scores(possible_final_rolls, score_card);
-
-        // Step 3: Find the best roll with the highest score and minimal difference
-        auto best_roll = find_best_roll(scores, dice_rolls);
-
-        // Step 4: Determine which dice to keep
-        auto dice_to_keep = determine_dice_to_keep(best_roll, dice_rolls, kept_dice);
-
-        return dice_to_keep;
+        return TurnSolver::best_keep(open_mask, kept_dice, dice_rolls, rolls_left);
     }
 
 /**********************************************************************
@@ -271,27 +225,96 @@ Purpose: To identify potential categories that the computer could pursue
 Parameters:
             score_card, a constant reference to a ScoreCard object. It holds
             the current state of the scorecard.
-            kept_dice, a vector of integers. It contains the dice values that
+            kept_dice, a Hand. It contains the dice values that
             the computer has decided to keep for the current turn.
-Return Value: An optional map of Category to Reason. It represents the
-                categories the computer can pursue along with reasons for
-                pursuing each category.
+Return Value: A shared_ptr to the cached map of Category to Reason. It
+                represents the categories the computer can pursue along
+                with reasons for pursuing each category; it is shared, not
+                copied.
+Algorithm:
+            1) Look the pursuits of the kept dice and the scorecard's open
+                categories up in the process-wide cache.
+Reference: none
+********************************************************************* */
+    shared_ptr<const map<Category, Reason>> get_category_pursuits(const ScoreCard &score_card,
+                                                                  const Hand &kept_dice) override
+    {
+        TRACE_SPAN("Computer::get_category_pursuits");
+        return get_cached_category_pursuits(score_card.get_open_mask(), kept_dice);
+    }
+
+/**********************************************************************
+Function Name: get_cached_category_pursuits
+Purpose: To get the category pursuits of kept dice against a set of open
+            categories, computing them only the first time any thread of
+            the process asks.
+Parameters:
+            open_mask, a 12-bit category mask. It holds the categories
+            that can still be filled.
+            kept_dice, a Hand. It contains the dice kept for the turn.
+Return Value: A shared_ptr to the cached map of Category to Reason; it
+                stays valid after the cache is cleared.
+Algorithm:
+            1) Key the cache by the kept dice's hand index and the open
+                mask.
+            2) Look the key up under a shared lock and return the entry
+                if it is there.
+            3) Otherwise compute the pursuits without holding the lock and
+                insert them under an exclusive lock, clearing the cache
+                first if it is full; if another thread inserted them
+                first, keep its entry.
+Reference: none
+********************************************************************* */
+    static shared_ptr<const map<Category, Reason>> get_cached_category_pursuits(const uint16_t open_mask,
+                                                                               const Hand &kept_dice)
+    {
+        static PursuitCache cache;
+        const uint32_t key = static_cast<uint32_t>(TurnSolver::index(kept_dice)) << NUM_CATEGORIES | open_mask;
+        {
+            const shared_lock<shared_mutex> lock(cache.cache_mutex);
+            const auto found = cache.pursuits.find(key);
+            if (found != cache.pursuits.end())
+            {
+                return found->second;
+            }
+        }
+
+        auto pursuits = make_shared<const map<Category, Reason>>(compute_category_pursuits(open_mask, kept_dice));
+        const unique_lock<shared_mutex> lock(cache.cache_mutex);
+        if (cache.pursuits.size() >= PursuitCache::MAX_ENTRIES)
+        {
+            cache.pursuits.clear();
+        }
+        return cache.pursuits.emplace(key, move(pursuits)).first->second;
+    }
+
+/**********************************************************************
+Function Name: compute_category_pursuits
+Purpose: To work out the category pursuits of kept dice against a set
+            of open categories.
+Parameters:
+            open_mask, a 12-bit category mask. It holds the categories
+            that can still be filled.
+            kept_dice, a Hand. It contains the dice kept for the turn.
+Return Value: A map of Category to Reason for every open category the
+                kept dice can still reach.
 Algorithm:
-            1) Generate all possible final rolls based on the kept dice.
-            2) Retrieve possible categories from the scorecard that can
-                be pursued with the kept dice.
+            1) Get every outcome of rolling the dice that are not kept,
+                with its exact probability, from the reroll table.
+            2) Retrieve the open categories that can be pursued with the
+                kept dice.
             3) For each category, calculate the minimum and maximum scores
-                possible using the generated rolls.
+                possible over the outcomes, the expected score and the
+                chance of reaching the maximum.
             4) Store the results in a map, associating each category with
                 the corresponding reasons.
 Reference: none
 Optional: cppreference.com
 ********************************************************************* */
-    optional<map<Category, Reason>> get_category_pursuits(const ScoreCard &score_card,
-                                                          const vector<int> &kept_dice) override
+    static map<Category, Reason> compute_category_pursuits(const uint16_t open_mask, const Hand &kept_dice)
     {
-        auto possible_final_rolls = generate_possible_final_rolls(kept_dice);
-        auto possible_categories = score_card.get_possible_categories(kept_dice);
+        const RerollOutcomes outcomes = get_reroll_outcomes(kept_dice);
+        const vector<Category> possible_categories = get_categories(get_possible_mask(kept_dice) & open_mask);
 
         // Find the minimum and maximum scores for each category
         // Store reasons for pursuing categories
@@ -307,31 +330,46 @@ Optional: cppreference.com
             int min_dice_diff = numeric_limits<int>::max();
             int max_dice_diff = numeric_limits<int>::max();
 
-            vector<int> roll_to_get_max;
-            vector<int> roll_to_get_min;
+            Hand roll_to_get_max;
+            Hand roll_to_get_min;
 
-            for (const auto &roll : possible_final_rolls)
+            double expected_score = 0;
+            for (const RerollOutcome &outcome : outcomes)
             {
-                int dice_diff = difference(roll, kept_dice).size();
-                if (get_score(roll, category) >= max_score && dice_diff <= max_dice_diff)
+                const Hand &roll = outcome.final_hand;
+                const Hand roll_diff = roll.difference(kept_dice);
+                const int dice_diff = roll_diff.size();
+                const int score = get_score(roll, category);
+                expected_score += outcomes.get_probability(outcome) * score;
+                if (score >= max_score && dice_diff <= max_dice_diff)
                 {
-                    max_score = get_score(roll, category);
-                    roll_to_get_max = difference(roll, kept_dice);
+                    max_score = score;
+                    roll_to_get_max = roll_diff;
                     max_dice_diff = dice_diff;
                 }
 
-                if (get_score(roll, category) < min_score && dice_diff <= min_dice_diff)
+                if (score < min_score && dice_diff <= min_dice_diff)
                 {
                     if (min_score == 0)
                         continue;
-                    min_score = get_score(roll, category);
-                    roll_to_get_min = difference(roll, kept_dice);
+                    min_score = score;
+                    roll_to_get_min = roll_diff;
                     min_dice_diff = dice_diff;
                 }
             }
 
-            category_pursuits[category] = Reason{
-                kept_dice, category, max_score, roll_to_get_max, min_score, roll_to_get_min};
+            // Chance that the next roll reaches the maximum score
+            double max_probability = 0;
+            for (const RerollOutcome &outcome : outcomes)
+            {
+                if (get_score(outcome.final_hand, category) == max_score)
+                {
+                    max_probability += outcomes.get_probability(outcome);
+                }
+            }
+
+            category_pursuits[category] = Reason{kept_dice, category, max_score, roll_to_get_max,
+                                                 min_score, roll_to_get_min, max_probability, expected_score};
         }
         return category_pursuits;
     }
@@ -343,13 +381,13 @@ Purpose: To identify the best category and strategy for the computer
 Parameters:
             score_card, a constant reference to a ScoreCard object. It holds
             the current state of the scorecard.
-            kept_dice, a vector of integers. It contains the dice values that
+            kept_dice, a Hand. It contains the dice values that
             the computer has decided to keep for the current turn.
 Return Value: An optional pair containing the best category and the dice
                 combination needed to achieve it.
 Algorithm:
             1) Determine the best possible roll that can be achieved
-                with the kept dice.
+                with the kept dice, from the policy table if one is loaded.
             2) Identify the category that offers the maximum score for
                 the best roll.
             3) If a category exists, return it along with the difference
@@ -357,16 +395,18 @@ Algorithm:
 Reference: none
 Optional: cppreference.com
 ********************************************************************* */
-    optional<pair<Category, vector<int>>> get_target(const ScoreCard &score_card,
-                                                     const vector<int> &kept_dice) override
+    optional<pair<Category, Hand>> get_target(const ScoreCard &score_card, const Hand &kept_dice) override
     {
-        auto best_roll = get_best_roll(score_card, kept_dice);
+        TRACE_SPAN("Computer::get_target");
+        const PolicyTable *policy = PolicyTable::loaded();
+        auto best_roll = policy != nullptr ? policy->get_target(score_card.get_open_mask(), kept_dice)
+                                           : get_best_roll(score_card, kept_dice);
         auto category = score_card.get_max_scoring_category(best_roll);
         if (!category.has_value())
         {
             return nullopt;
         }
-        return make_pair(category.value(), difference(best_roll, kept_dice));
+        return make_pair(category.value(), best_roll.difference(kept_dice));
     }
 
 /**********************************************************************
@@ -376,10 +416,12 @@ Purpose: To decide whether the computer should stop rolling based on
 Parameters:
             score_card, a constant reference to a ScoreCard object. It holds
             the current state of the scorecard.
-            kept_dice, a vector of integers. It contains the dice values
+            kept_dice, a Hand. It contains the dice values
             that the computer has decided to keep.
-            dice_rolls, a vector of integers. It represents the current
+            dice_rolls, a Hand. It represents the current
             dice rolls in the turn.
+            rolls_left, an integer. It is the number of rolls still
+            allowed after this one.
 Return Value: A boolean value indicating whether the computer wants to
                 stop rolling (true) or continue rolling (false).
 Algorithm:
@@ -389,13 +431,14 @@ Algorithm:
                 the computer should stop rolling.
 Reference: none
     ********************************************************************* */
-    bool wants_to_stand(const ScoreCard &score_card, const vector<int> &kept_dice,
-                        const vector<int> &dice_rolls) override
+    bool wants_to_stand(const ScoreCard &score_card, const Hand &kept_dice, const Hand &dice_rolls,
+                        const int rolls_left) override
     {
-        auto dice_to_keep = get_dice_to_keep(score_card, dice_rolls, kept_dice);
+        TRACE_SPAN("Computer::wants_to_stand");
+        const Hand dice_to_keep = get_dice_to_keep(score_card, dice_rolls, kept_dice, rolls_left);
 
         // If all dice should be kept, stop rolling
-        return unordered_equal(dice_to_keep, dice_rolls);
+        return dice_to_keep == dice_rolls;
     }
 
 /**********************************************************************
@@ -421,10 +464,12 @@ Purpose: To generate advice for a human player based on the current
 Parameters:
             score_card, a constant reference to a ScoreCard object. It holds
             the current state of the scorecard.
-            kept_dice, a vector of integers. It contains the dice values
+            kept_dice, a Hand. It contains the dice values
             that the player has decided to keep.
-            dice_rolls, a vector of integers. It represents the current
+            dice_rolls, a Hand. It represents the current
             dice rolls in the turn.
+            rolls_left, an integer. It is the number of rolls still
+            allowed after this one.
 Return Value: A string containing advice for the player regarding which
                 dice to keep and potential scoring categories to target.
 Algorithm:
@@ -439,28 +484,30 @@ Algorithm:
                 on the game state.
 Reference: none
 ********************************************************************* */
-    string get_help(const ScoreCard &score_card, const vector<int> &kept_dice, const vector<int> &dice_rolls)
+    string get_help(const ScoreCard &score_card, const Hand &kept_dice, const Hand &dice_rolls, const int rolls_left)
     {
+        TRACE_SPAN("Computer::get_help");
 
         // Get the recommended dice to keep based on the current scorecard and dice rolls
-        auto dice_to_keep = get_dice_to_keep(score_card, dice_rolls, kept_dice);
+        auto dice_to_keep = get_dice_to_keep(score_card, dice_rolls, kept_dice, rolls_left);
 
         // Combine kept dice and the newly suggested dice to keep
         // This is the final dice that we hope to put in the scorecard
-        auto help_dice = concatenate(kept_dice, dice_to_keep);
+        const Hand help_dice = kept_dice + dice_to_keep;
 
         // Determine which categories the player could pursue based on the dice
         // Gets a map of category and the Reason
         // Reason is a struct that includes details such as max and min scores and the dice combination to achieve them
-        auto category_pursuits = get_category_pursuits(score_card, help_dice);
+        const shared_ptr<const map<Category, Reason>> category_pursuits =
+            get_cached_category_pursuits(score_card.get_open_mask(), help_dice);
 
         // Get the player's target category and the best dice combination to achieve it
         auto target = get_target(score_card, help_dice);
 
-        string help_message = "You should keep: " + to_string_vector(dice_to_keep) + " becauseL\n";
+        string help_message = "You should keep: " + to_string_hand(dice_to_keep) + " becauseL\n";
 
         // Loop through the possible category pursuits and give reasons for each
-        for (const auto &[category, reason] : category_pursuits.value())
+        for (const auto &[category, reason] : *category_pursuits)
         {
 
             // If the minimum score for the category is 0, provide advice based on max score potential
@@ -469,15 +516,15 @@ Reference: none
                 help_message += " - You can get " + CATEGORY_NAMES[reason.pursued_category] +
                                 " with a score of " + to_string(reason.max_score) + ". For example, "
                                                                                     "by rolling " +
-                                to_string_vector(reason.roll_to_get_max) + "\n";
+                                to_string_hand(reason.roll_to_get_max) + to_string_odds(reason) + "\n";
                 continue;
             }
             // Otherwise, provide both the minimum and maximum score potential and the dice needed
             help_message += " - You can get " + CATEGORY_NAMES[reason.pursued_category] +
                             " with a minimum score of " + to_string(reason.min_score) +
-                            " by getting " + to_string_vector(reason.roll_to_get_min) +
+                            " by getting " + to_string_hand(reason.roll_to_get_min) +
                             " and a maximum score of " + to_string(reason.max_score) +
-                            " by rolling " + to_string_vector(reason.roll_to_get_max) + "\n";
+                            " by rolling " + to_string_hand(reason.roll_to_get_max) + to_string_odds(reason) + "\n";
         }
 
         // Advise the player on which category they should target based on current rolls
@@ -485,7 +532,7 @@ Reference: none
         if (target.has_value())
         {
             help_message += CATEGORY_NAMES[target.value().first] + ". A way to do this would be to roll " +
-                            to_string_vector(target.value().second) + " in your subsequent rolls."
+                            to_string_hand(target.value().second) + " in your subsequent rolls."
                                                                       "\n";
         }
         else
@@ -494,7 +541,7 @@ Reference: none
         }
 
         // Suggest if the player should stop rolling (stand) or keep rolling based on the game state
-        if (wants_to_stand(score_card, kept_dice, dice_rolls))
+        if (wants_to_stand(score_card, kept_dice, dice_rolls, rolls_left))
         {
             help_message += "You should stand.\n";
         }
@@ -510,7 +557,7 @@ Reference: none
         }
         else
         {
-            help_message += "You should keep the following dice before you roll: " + to_string_vector(dice_to_keep);
+            help_message += "You should keep the following dice before you roll: " + to_string_hand(dice_to_keep);
         }
         return help_message;
     }
@@ -0,0 +1,65 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+/* *********************************************************************
+Function Name: build_crc32_table
+Purpose: To build the lookup table of the CRC-32 checksum at compile time.
+Parameters: None
+Return Value: An array with the CRC of every byte value.
+Algorithm:
+            1) For each byte, run the 8 shift-and-xor steps of the reflected polynomial 0xEDB88320.
+Reference: CRC-32 as used by zlib and PNG (ISO 3309)
+********************************************************************* */
+constexpr array<uint32_t, 256> build_crc32_table()
+{
+    array<uint32_t, 256> table{};
+    for (uint32_t byte = 0; byte < 256; byte++)
+    {
+        uint32_t crc = byte;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1u) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+        table[byte] = crc;
+    }
+    return table;
+}
+
+// CRC of every byte value
+inline constexpr array<uint32_t, 256> CRC32_TABLE = build_crc32_table();
+
+
+/* *********************************************************************
+Function Name: crc32
+Purpose: To compute the CRC-32 checksum of a block of bytes.
+Parameters:
+            data, a pointer to the bytes.
+            size, the number of bytes.
+            crc, an unsigned 32-bit integer. It is the checksum of the bytes before data, 0 for none.
+Return Value: The checksum of the previous bytes followed by data.
+Algorithm:
+            1) Invert the running checksum, fold in every byte through the table and invert it back.
+Reference: CRC-32 as used by zlib and PNG (ISO 3309)
+********************************************************************* */
+inline uint32_t crc32(const uint8_t *data, const size_t size, uint32_t crc = 0)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++)
+    {
+        crc = CRC32_TABLE[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
@@ -9,7 +9,9 @@
 #pragma once
 
 #include <vector>
-#include <random>
+
+#include "DiceSource.h"
+#include "Hand.h"
 
 using namespace std;
 
@@ -22,17 +24,13 @@ Purpose: To simulate the rolling of a single six-sided die.
 Parameters: None
 Return Value: An integer representing the result of the die roll (1 to 6).
 Algorithm:
-        1) Generate a random number between 1 and 6 using a random number generator.
+        1) Draw a face from the calling thread's seeded DiceSource.
         2) Return the generated number as the result of the die roll.
 Reference: none
 ********************************************************************* */
     static int roll_die()
     {
-        random_device rd;
-        mt19937 gen(rd());
-        uniform_int_distribution<> dis(1, 6);
-
-        return dis(gen);
+        return DiceSource::thread_source().roll_die();
     }
 
 
@@ -43,31 +41,75 @@ Reference: none
                 num_dice, an integer passed by value. It specifies how many dice to roll.
     Return Value: A vector of integers representing the results of each die roll.
     Algorithm:
-            1) Create a vector to store the results of each dice roll.
-            2) Reserve space in the vector to optimize memory allocation for the specified number of dice.
-            3) Loop through the number of dice to roll.
-            4) In each iteration, roll a die and store the result in the vector.
-            5) Return the vector containing all the dice roll results.
+            1) Roll the dice from the calling thread's DiceSource.
+            2) Return the vector containing all the dice roll results.
     Reference: none
     ********************************************************************* */
     static vector<int> roll_dice(const int num_dice)
     {
-        // Vector to store the results of each dice roll
-        vector<int> dice_rolls;
+        return roll_dice(num_dice, DiceSource::thread_source());
+    }
+
+
+/* *********************************************************************
+Function Name: roll_dice
+Purpose: To roll a specified number of dice from a caller-owned dice source.
+Parameters:
+            num_dice, an integer passed by value. It specifies how many dice to roll.
+            source, a DiceSource passed by reference. It is the source the rolls are drawn from.
+Return Value: A vector of integers representing the results of each die roll.
+Algorithm:
+        1) Size the result vector for the specified number of dice.
+        2) Fill it in one batch from the given source.
+        3) Return the vector containing all the dice roll results.
+Reference: none
+********************************************************************* */
+    static vector<int> roll_dice(const int num_dice, DiceSource &source)
+    {
+        vector<int> dice_rolls(num_dice);
+        source.roll_dice(num_dice, dice_rolls.data());
+        return dice_rolls;
+    }
+
 
-        // Reserve space for the specified number of dice to optimize memory allocation
-        dice_rolls.reserve(num_dice);
+/* *********************************************************************
+Function Name: roll_hand
+Purpose: To roll a specified number of dice straight into a Hand without allocating.
+Parameters:
+            num_dice, an integer passed by value. It specifies how many dice to roll (at most 5).
+            source, a DiceSource passed by reference. It is the source the rolls are drawn from.
+Return Value: A Hand holding the rolled dice.
+Algorithm:
+        1) Roll the dice into a buffer on the stack.
+        2) Add every rolled die to the hand and return it.
+Reference: none
+********************************************************************* */
+    static Hand roll_hand(const int num_dice, DiceSource &source)
+    {
+        int dice_rolls[5];
+        source.roll_dice(num_dice, dice_rolls);
 
+        Hand hand;
         for (int i = 0; i < num_dice; i++)
         {
-
-            // Roll a die and add the result to the vector
-            dice_rolls.push_back(roll_die());
+            hand = hand.add(dice_rolls[i]);
         }
-
-        // Return the vector containing all the dice roll results
-        return dice_rolls;
+        return hand;
     }
 
-    
+
+/* *********************************************************************
+Function Name: roll_hand
+Purpose: To roll a specified number of dice from the calling thread's DiceSource into a Hand.
+Parameters:
+            num_dice, an integer passed by value. It specifies how many dice to roll (at most 5).
+Return Value: A Hand holding the rolled dice.
+Algorithm:
+        1) Roll the hand from the calling thread's DiceSource.
+Reference: none
+********************************************************************* */
+    static Hand roll_hand(const int num_dice)
+    {
+        return roll_hand(num_dice, DiceSource::thread_source());
+    }
 };
@@ -0,0 +1,256 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// Number of distinct rolls of 0 to 5 dice, ignoring order (1 + 6 + 21 + 56 + 126 + 252)
+constexpr int NUM_DICE_COMBINATIONS = 462;
+
+// DICE_COMBINATIONS below is the one enumeration of these rolls. ALL_HANDS (Hand.h), the reroll table
+// and the turn solver's tables are all derived from it, so a roll's index means the same everywhere.
+
+// Number of ordered rolls of five dice, 6^5
+constexpr int NUM_DICE_PERMUTATIONS = 7776;
+
+// The dice of one enumerated roll; a roll of n dice uses the first n slots
+using DiceRow = array<uint8_t, 5>;
+
+// A read-only view of one enumerated roll
+class DiceRoll
+{
+public:
+    constexpr DiceRoll(const DiceRow &row, const int num_dice) : row(&row), num_dice(num_dice)
+    {
+    }
+
+    constexpr const uint8_t *begin() const
+    {
+        return row->data();
+    }
+
+    constexpr const uint8_t *end() const
+    {
+        return row->data() + num_dice;
+    }
+
+    constexpr int size() const
+    {
+        return num_dice;
+    }
+
+    constexpr int operator[](const int i) const
+    {
+        return (*row)[i];
+    }
+
+    // The dice as a vector, for code that still works on vector<int>
+    vector<int> to_vector() const
+    {
+        return vector<int>(begin(), end());
+    }
+
+private:
+    const DiceRow *row;
+    int num_dice;
+};
+
+// A read-only view of every enumerated roll of n dice: count rows of a table, stride rows apart
+class DiceRolls
+{
+public:
+    class iterator
+    {
+    public:
+        constexpr iterator(const DiceRow *row, const int stride, const int num_dice)
+            : row(row), stride(stride), num_dice(num_dice)
+        {
+        }
+
+        constexpr DiceRoll operator*() const
+        {
+            return DiceRoll(*row, num_dice);
+        }
+
+        constexpr iterator &operator++()
+        {
+            row += stride;
+            return *this;
+        }
+
+        constexpr bool operator!=(const iterator &other) const
+        {
+            return row != other.row;
+        }
+
+    private:
+        const DiceRow *row;
+        int stride;
+        int num_dice;
+    };
+
+    constexpr DiceRolls(const DiceRow *first, const int count, const int stride, const int num_dice)
+        : first(first), count(count), stride(stride), num_dice(num_dice)
+    {
+    }
+
+    constexpr iterator begin() const
+    {
+        return iterator(first, stride, num_dice);
+    }
+
+    constexpr iterator end() const
+    {
+        return iterator(first + count * stride, stride, num_dice);
+    }
+
+    constexpr int size() const
+    {
+        return count;
+    }
+
+    constexpr DiceRoll operator[](const int i) const
+    {
+        return DiceRoll(first[i * stride], num_dice);
+    }
+
+private:
+    const DiceRow *first;
+    int count;
+    int stride;
+    int num_dice;
+};
+
+// Every roll of 0 to 5 dice ignoring order, grouped by number of dice
+struct DiceCombinationTable
+{
+    // The rolls of n dice are rows[first_row[n]] to rows[first_row[n + 1] - 1]
+    array<uint16_t, 7> first_row;
+    array<DiceRow, NUM_DICE_COMBINATIONS> rows;
+};
+
+
+/* *********************************************************************
+Function Name: build_dice_combination_table
+Purpose: To list every roll of 0 to 5 dice ignoring order, at compile time.
+Parameters: None
+Return Value: The DiceCombinationTable.
+Algorithm:
+            1) For each number of dice, walk the dice in ascending order from all ones to all sixes:
+               raise the rightmost die below 6 and set every die after it to the same face.
+            2) Record where each number of dice starts.
+Reference: none
+********************************************************************* */
+constexpr DiceCombinationTable build_dice_combination_table()
+{
+    DiceCombinationTable table{};
+    int next = 0;
+    for (int size = 0; size <= 5; size++)
+    {
+        table.first_row[size] = static_cast<uint16_t>(next);
+        DiceRow dice{1, 1, 1, 1, 1};
+        while (true)
+        {
+            table.rows[next++] = dice;
+
+            int i = size - 1;
+            while (i >= 0 && dice[i] == 6)
+            {
+                i--;
+            }
+            if (i < 0)
+            {
+                break;
+            }
+            dice[i]++;
+            for (int j = i + 1; j < size; j++)
+            {
+                dice[j] = dice[i];
+            }
+        }
+    }
+    table.first_row[6] = static_cast<uint16_t>(next);
+    return table;
+}
+
+
+/* *********************************************************************
+Function Name: build_dice_permutation_table
+Purpose: To list every ordered roll of five dice, at compile time.
+Parameters: None
+Return Value: The 7776 rolls, the first die changing slowest.
+Algorithm:
+            1) Read row r as a five-digit base-6 number, the first die as the highest digit.
+Reference: none
+********************************************************************* */
+constexpr array<DiceRow, NUM_DICE_PERMUTATIONS> build_dice_permutation_table()
+{
+    array<DiceRow, NUM_DICE_PERMUTATIONS> table{};
+    for (int r = 0; r < NUM_DICE_PERMUTATIONS; r++)
+    {
+        for (int d = 4, rest = r; d >= 0; d--, rest /= 6)
+        {
+            table[r][d] = static_cast<uint8_t>(rest % 6 + 1);
+        }
+    }
+    return table;
+}
+
+
+// Every roll of 0 to 5 dice ignoring order, computed by the compiler
+inline constexpr DiceCombinationTable DICE_COMBINATIONS = build_dice_combination_table();
+
+// Every ordered roll of five dice, computed by the compiler
+inline constexpr array<DiceRow, NUM_DICE_PERMUTATIONS> DICE_PERMUTATIONS = build_dice_permutation_table();
+
+static_assert(DICE_COMBINATIONS.first_row[6] == NUM_DICE_COMBINATIONS, "every roll ignoring order is listed");
+
+
+/* *********************************************************************
+Function Name: dice_combinations
+Purpose: To get every possible roll of n dice, ignoring order
+Parameters:
+            n, an integer from 0 to 5. It is the number of dice rolled
+Return Value: A view of the rolls in DICE_COMBINATIONS, each with its dice in ascending order,
+              the rolls in ascending order
+Algorithm:
+            1) Return the range of rows of n dice
+Reference: none
+********************************************************************* */
+constexpr DiceRolls dice_combinations(const int n)
+{
+    const int first = DICE_COMBINATIONS.first_row[n];
+    return DiceRolls(DICE_COMBINATIONS.rows.data() + first, DICE_COMBINATIONS.first_row[n + 1] - first, 1, n);
+}
+
+
+/* *********************************************************************
+Function Name: get_dice_permutation
+Purpose: To get every ordered roll of a given number of dice
+Parameters:
+            num_dice, an integer from 0 to 5. It represents the number of dice
+Return Value: A view of the 6^num_dice rolls in DICE_PERMUTATIONS, the first die changing slowest
+Algorithm:
+            1) Rows whose last 5 - num_dice dice are all ones list the rolls of the first num_dice dice
+               in order, 6^(5 - num_dice) rows apart
+Reference: none
+********************************************************************* */
+constexpr DiceRolls get_dice_permutation(const int num_dice)
+{
+    int stride = 1;
+    for (int d = num_dice; d < 5; d++)
+    {
+        stride *= 6;
+    }
+    return DiceRolls(DICE_PERMUTATIONS.data(), NUM_DICE_PERMUTATIONS / stride, stride, num_dice);
+}
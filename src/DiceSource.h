@@ -0,0 +1,195 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+using namespace std;
+
+// Fast seeded source of dice values (xoshiro256** generator).
+// One source is meant to be owned per thread or per game; it is not thread safe.
+class DiceSource
+{
+public:
+    // Types required to use the source with the standard <random> distributions
+    using result_type = uint64_t;
+
+/* *********************************************************************
+Function Name: DiceSource (Constructor)
+Purpose: To create a dice source from a 64-bit seed.
+Parameters:
+            seed, an unsigned 64-bit integer. The same seed always produces the same dice.
+Return Value: None
+Algorithm:
+            1) Expand the seed into the four words of generator state.
+Reference: xoshiro256** and splitmix64 by David Blackman and Sebastiano Vigna (prng.di.unimi.it)
+********************************************************************* */
+    explicit DiceSource(const uint64_t seed = 0)
+    {
+        this->seed(seed);
+    }
+
+
+/* *********************************************************************
+Function Name: seed
+Purpose: To reset the generator state from a 64-bit seed.
+Parameters:
+            seed, an unsigned 64-bit integer.
+Return Value: None
+Algorithm:
+            1) Run splitmix64 four times over the seed to fill the state, which is never all zero.
+Reference: splitmix64 by Sebastiano Vigna
+********************************************************************* */
+    void seed(uint64_t seed)
+    {
+        for (uint64_t &word : state)
+        {
+            seed += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            word = z ^ (z >> 31);
+        }
+    }
+
+
+/* *********************************************************************
+Function Name: next
+Purpose: To produce the next 64 random bits.
+Parameters: None
+Return Value: An unsigned 64-bit random integer.
+Algorithm:
+            1) Scramble the second state word for the output.
+            2) Advance the state with the xoshiro256 shift/rotate steps.
+Reference: xoshiro256** by David Blackman and Sebastiano Vigna
+********************************************************************* */
+    uint64_t next()
+    {
+        const uint64_t result = rotate_left(state[1] * 5, 7) * 9;
+        const uint64_t t = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotate_left(state[3], 45);
+
+        return result;
+    }
+
+    // UniformRandomBitGenerator interface so the source also works with <random> distributions
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return numeric_limits<result_type>::max(); }
+    result_type operator()() { return next(); }
+
+
+/* *********************************************************************
+Function Name: roll_die
+Purpose: To roll a single six-sided die.
+Parameters: None
+Return Value: An integer between 1 and 6.
+Algorithm:
+            1) Map 32 random bits to a face with an unbiased multiply-shift.
+Reference: Lemire, "Fast Random Integer Generation in an Interval"
+********************************************************************* */
+    int roll_die()
+    {
+        return face_from_bits(static_cast<uint32_t>(next() >> 32));
+    }
+
+
+/* *********************************************************************
+Function Name: roll_dice
+Purpose: To roll several dice into a caller supplied buffer without allocating.
+Parameters:
+            num_dice, an integer. It specifies how many dice to roll.
+            out, a pointer to at least num_dice integers. It receives the rolled values.
+Return Value: None
+Algorithm:
+            1) Draw 64 random bits for every two dice.
+            2) Turn each 32-bit half into a face with the unbiased multiply-shift.
+Reference: Lemire, "Fast Random Integer Generation in an Interval"
+********************************************************************* */
+    void roll_dice(const int num_dice, int *out)
+    {
+        int i = 0;
+        for (; i + 1 < num_dice; i += 2)
+        {
+            const uint64_t bits = next();
+            out[i] = face_from_bits(static_cast<uint32_t>(bits >> 32));
+            out[i + 1] = face_from_bits(static_cast<uint32_t>(bits));
+        }
+        if (i < num_dice)
+        {
+            out[i] = roll_die();
+        }
+    }
+
+
+/* *********************************************************************
+Function Name: random_bool
+Purpose: To produce a fair random boolean.
+Parameters: None
+Return Value: true or false with equal probability.
+Algorithm:
+            1) Return the top bit of the next random word.
+Reference: none
+********************************************************************* */
+    bool random_bool()
+    {
+        return (next() >> 63) != 0;
+    }
+
+
+/* *********************************************************************
+Function Name: thread_source
+Purpose: To get the dice source owned by the calling thread.
+Parameters: None
+Return Value: A reference to the calling thread's DiceSource.
+Algorithm:
+            1) On first use in a thread, seed a new source once from random_device.
+            2) Return the same source on every later call from that thread.
+Reference: none
+********************************************************************* */
+    static DiceSource &thread_source()
+    {
+        thread_local DiceSource source(initial_seed());
+        return source;
+    }
+
+
+private:
+    uint64_t state[4];
+
+    static uint64_t rotate_left(const uint64_t x, const int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    // Multiply-shift from 32 bits to 0-5, rejecting the 4 low values that would bias the result
+    int face_from_bits(uint32_t bits)
+    {
+        uint64_t product = static_cast<uint64_t>(bits) * 6;
+        while (static_cast<uint32_t>(product) < 4)
+        {
+            bits = static_cast<uint32_t>(next() >> 32);
+            product = static_cast<uint64_t>(bits) * 6;
+        }
+        return static_cast<int>(product >> 32) + 1;
+    }
+
+    static uint64_t initial_seed()
+    {
+        random_device rd;
+        return (static_cast<uint64_t>(rd()) << 32) ^ rd();
+    }
+};
@@ -8,8 +8,11 @@
 */
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <memory>
 
+#include "BinarySave.h"
 #include "Human.h"
 #include "ScoreCard.h"
 #include "Round.h"
@@ -20,6 +23,10 @@ struct Game
     const int current_round;
     const vector<shared_ptr<Player>> players;
 
+    // Indices of the players who already took their turn in current_round; only a game recovered
+    // from a journal in the middle of a round has any
+    const vector<int> finished_players;
+
 /* *********************************************************************
 Function Name: Game (Constructor)
 Purpose: Initializes a Game object with a scorecard, round number, and list of players.
@@ -27,16 +34,21 @@ Parameters:
             score_card, a ScoreCard passed by reference. It represents the current scorecard.
             current_round, an integer passed by value. It indicates the current round number.
             players, a vector of shared_ptr<Player> passed by reference. It contains the players in the game.
+            finished_players, a vector of player indices passed by reference. It holds the players who
+                already took their turn in current_round; empty by default.
 Return Value: None
 Algorithm:
         1) Initialize the score_card with the provided scorecard.
         2) Set the current_round to the given round number.
         3) Initialize the players vector with the provided list of players.
+        4) Initialize the players who already finished the round.
 Reference: none
 ********************************************************************* */
     Game(const ScoreCard &score_card, const int current_round,
-         const vector<shared_ptr<Player>> &players) : score_card(score_card),
-                                                      current_round(current_round), players(players)
+         const vector<shared_ptr<Player>> &players,
+         const vector<int> &finished_players = {}) : score_card(score_card),
+                                                     current_round(current_round), players(players),
+                                                     finished_players(finished_players)
     {
     }
 
@@ -50,10 +62,11 @@ Return Value: None
 Algorithm:
         1) Initialize the score_card with the scorecard of the other Game object.
         2) Set the current_round to the round number of the other Game object.
-        3) Copy the players vector from the other Game object.
+        3) Copy the players vector and finished players from the other Game object.
 Reference: none
 ********************************************************************* */
-    Game(const Game &other) : score_card(other.score_card), current_round(other.current_round), players(other.players)
+    Game(const Game &other) : score_card(other.score_card), current_round(other.current_round), players(other.players),
+                              finished_players(other.finished_players)
     {
     }
 
@@ -112,7 +125,7 @@ Reference: none
         // Extract the scorecard lines and reconstruct the scorecard from serialized data
         vector<string> scorecard_lines(lines.begin() + scorecard_start, lines.end());
         string scorecard_serial = join(scorecard_lines, '\n');
-        ScoreCard score_card = ScoreCard::deserialize(scorecard_serial, human, computer);
+        ScoreCard score_card = ScoreCard::deserialize(scorecard_serial, players);
 
         // Return a new Game object with the deserialized scorecard, round number, and players
         return Game(score_card, round_number, players);
@@ -136,11 +149,52 @@ Reference: none
         stringstream serial;
         serial << "Round: " << current_round << endl;
         serial << "Scorecard:" << endl;
-        serial << score_card.serialize() << endl;
+        serial << score_card.serialize(players) << endl;
         return serial.str();
     }
 
 
+/* *********************************************************************
+    Function Name: serialize_binary
+    Purpose: Converts the current game state into the compact binary save format.
+    Parameters: None
+    Return Value: An array of BINARY_SAVE_SIZE bytes holding the game state.
+    Algorithm:
+            1) Encode the scorecard and current round; the scorecard's player indices are the game's.
+    Reference: none
+    ********************************************************************* */
+    array<uint8_t, BINARY_SAVE_SIZE> serialize_binary() const
+    {
+        array<uint8_t, BINARY_SAVE_SIZE> bytes;
+        BinarySave::encode(score_card, current_round, bytes.data());
+        return bytes;
+    }
+
+
+/* *********************************************************************
+    Function Name: deserialize_binary
+    Purpose: Reconstruct a Game object from a binary save.
+    Parameters:
+                data, a pointer to the saved bytes.
+                size, the number of saved bytes.
+    Return Value: A Game object reconstructed from the saved data.
+    Algorithm:
+            1) Create shared pointers for the human and computer players.
+            2) Decode the scorecard and round; BinarySave::decode throws if the save is corrupt.
+            3) Return a new Game object with the decoded scorecard, round number, and players.
+    Reference: none
+    ********************************************************************* */
+    static Game deserialize_binary(const uint8_t *data, const size_t size)
+    {
+        auto human = make_shared<Human>();
+        auto computer = make_shared<Computer>();
+
+        int round_number = 1;
+        ScoreCard score_card = BinarySave::decode(data, size, round_number);
+        return Game(score_card, round_number, {human, computer});
+    }
+
+
 /* *********************************************************************
     Function Name: operator=
     Purpose: Copy assignment operator for the Game struct.
@@ -164,6 +218,22 @@ Reference: none
     }
 
 
+/* *********************************************************************
+Function Name: use_seed
+Purpose: Makes the dice of the game played on this thread reproducible.
+Parameters:
+            seed, an unsigned 64-bit integer. It seeds every automatic roll, tie-breaker and first-player toss.
+Return Value: None
+Algorithm:
+        1) Reseed the calling thread's DiceSource, which every automatic die is drawn from.
+Reference: none
+********************************************************************* */
+    static void use_seed(const uint64_t seed)
+    {
+        DiceSource::thread_source().seed(seed);
+    }
+
+
 /* *********************************************************************
 Function Name: is_over
 Purpose: Checks if the game is over by checking if the scorecard is full.
@@ -203,7 +273,7 @@ Algorithm:
         1) Check if the game is over; if yes, print a message and return the current game object.
         2) Print the current round number.
         3) Show the scores of all players.
-        4) Play a round and get the updated scorecard.
+        4) Play a round, skipping the players who already finished it, and get the updated scorecard.
         5) Display the updated scorecard.
         6) Create and return a new Game object with the updated scorecard and incremented round number.
 Reference: none
@@ -220,10 +290,10 @@ Reference: none
         show_scores();
 
         // Play a round and get the updated scorecard
-        const ScoreCard new_score_card = Round::play_round(current_round, score_card, players);
+        const ScoreCard new_score_card = Round::play_round(current_round, score_card, players, finished_players);
 
         // Display the updated scorecard
-        cout << new_score_card.get_string() << endl;
+        cout << new_score_card.get_string(players) << endl;
 
         // Create and return a new Game object with the updated scorecard and incremented round number
         auto result = Game(new_score_card, current_round + 1, players);
@@ -261,23 +331,18 @@ Parameters: None
 Return Value: None
 Algorithm:
             1) Print "Scores:" to indicate the beginning of the score list
-            2) Call get_player_scores to retrieve current player scores
-            3) Iterate over the player scores map
-                a) For each player-score pair, print the player's name and their score
-            4) Print an empty line for better readability
+            2) For each player, print the player's name and their running total from the scorecard
+            3) Print an empty line for better readability
 Reference: None
 ********************************************************************* */
     void show_scores() const
     {
         cout << "Scores:" << endl;
 
-        // get the scores of each player
-        auto player_scores = get_player_scores();
-
-        // Iterate over each player's score
-        for (const auto &player_score : player_scores)
+        // Print each player's score
+        for (int i = 0; i < static_cast<int>(players.size()); i++)
         {
-            cout << player_score.first->get_name() << ": " << player_score.second << endl;
+            cout << players[i]->get_name() << ": " << score_card.get_player_score(i) << endl;
         }
         cout << endl;
     }
@@ -0,0 +1,346 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "AllocationStats.h"
+#include "Computer.h"
+#include "Dice.h"
+#include "ScoreCard.h"
+#include "Trace.h"
+
+using namespace std;
+
+// The kind of action a move in the game log records
+enum class MoveType
+{
+    Roll,
+    Keep,
+    Stand,
+    Score
+};
+
+// Struct to hold a single action taken during a headless game
+struct Move
+{
+    MoveType type;
+
+    // The round in which the move happened
+    int round;
+
+    // Index of the acting player in the engine's player list
+    int player;
+
+    // The roll (1 to 3) of the turn the move belongs to
+    int roll_number;
+
+    // Rolled dice for Roll, kept dice for Keep/Stand and final dice for Score
+    Hand dice;
+
+    // The filled category and its points, only set for Score moves
+    optional<Category> category;
+    int points;
+};
+
+// Struct to hold the outcome of a headless game
+struct GameResult
+{
+    ScoreCard score_card;
+    int rounds;
+    vector<Move> moves;
+
+    // Index of the player who took the first turn of the game
+    int first_player;
+};
+
+class GameEngine
+{
+public:
+/* *********************************************************************
+Function Name: GameEngine (Constructor)
+Purpose: To create a headless game engine that plays a full game without any console input or output.
+Parameters:
+            players, a vector of shared_ptr<Player> passed by reference. It holds the player policies.
+                Only the decision functions (get_dice_to_keep and wants_to_stand) are called, so the
+                players must not read from the console (e.g. Computer).
+            seed, an unsigned 64-bit integer. It seeds the dice source used for every die in the game.
+            record_moves, a boolean. It controls whether the move log is filled.
+Return Value: None
+Algorithm:
+            1) Store the players and the move logging flag.
+            2) Seed the engine's own dice source.
+Reference: none
+********************************************************************* */
+    GameEngine(const vector<shared_ptr<Player>> &players, const uint64_t seed,
+               const bool record_moves = true) : players(players), dice_source(seed), record_moves(record_moves)
+    {
+        if (players.size() != 2)
+        {
+            throw invalid_argument("GameEngine requires exactly two players");
+        }
+    }
+
+
+/* *********************************************************************
+Function Name: seed
+Purpose: To reseed the engine's dice so it can be reused for another game.
+Parameters:
+            seed, an unsigned 64-bit integer. It determines every roll and tie-breaker of the next game.
+Return Value: None
+Algorithm:
+            1) Reset the engine's dice source from the seed.
+Reference: none
+********************************************************************* */
+    void seed(const uint64_t seed)
+    {
+        dice_source.seed(seed);
+    }
+
+
+/* *********************************************************************
+Function Name: play
+Purpose: To play a complete game from an empty scorecard.
+Parameters: None
+Return Value: A GameResult holding the final scorecard, the number of rounds played and the move log.
+Algorithm:
+            1) Start with an empty scorecard in round 1.
+            2) Play rounds until the scorecard is full.
+            3) Return the final scorecard together with the moves recorded along the way.
+Reference: none
+********************************************************************* */
+    GameResult play()
+    {
+        return play(ScoreCard(), 1);
+    }
+
+
+/* *********************************************************************
+Function Name: play
+Purpose: To continue a game from a given scorecard and round until the scorecard is full.
+Parameters:
+            score_card, a ScoreCard passed by reference. It is the state to continue from.
+            round, an integer. It is the round number to continue from.
+Return Value: A GameResult holding the final scorecard, the number of rounds played and the move log.
+Algorithm:
+            1) Clear the move log and the first player.
+            2) While the scorecard is not full, play a round and advance the round number.
+            3) Return the final scorecard, the last round number, the move log and the first player.
+Reference: none
+********************************************************************* */
+    GameResult play(const ScoreCard &score_card, int round)
+    {
+        moves.clear();
+        first_player = -1;
+
+        ScoreCard current_score_card = score_card;
+        while (!current_score_card.is_full())
+        {
+            current_score_card = play_round(round, current_score_card);
+            round++;
+        }
+
+        return GameResult{current_score_card, round - 1, moves, first_player};
+    }
+
+
+/* *********************************************************************
+Function Name: get_turn_allocations
+Purpose: To get the allocations of every turn the engine played.
+Parameters: None
+Return Value: The AllocationTally of all turns; every count is zero unless the program counts allocations.
+Algorithm:
+            1) Return the tally that every turn adds itself to.
+Reference: none
+********************************************************************* */
+    const AllocationTally &get_turn_allocations() const
+    {
+        return turn_allocations;
+    }
+
+
+private:
+    const vector<shared_ptr<Player>> players;
+    DiceSource dice_source;
+    const bool record_moves;
+    vector<Move> moves;
+    int first_player = -1;
+    AllocationTally turn_allocations;
+
+/* *********************************************************************
+Function Name: play_round
+Purpose: To play one round, giving every player a turn in score order.
+Parameters:
+            round, an integer. It is the current round number.
+            score_card, a ScoreCard passed by reference. It is the scorecard at the start of the round.
+Return Value: The scorecard after every player has taken their turn.
+Algorithm:
+            1) Determine the player order (lowest score first, die toss on a tie); the first player of
+               the game's first round is the first player of the game.
+            2) For each player, play a turn on the current scorecard.
+            3) Choose the scorecard's category for the final dice once, then log it and fill it.
+            4) Stop early if the scorecard becomes full.
+Reference: none
+********************************************************************* */
+    ScoreCard play_round(const int round, const ScoreCard &score_card)
+    {
+        TRACE_SPAN("GameEngine::play_round");
+        ScoreCard current_score_card = score_card;
+
+        const array<int, 2> player_order = get_player_order(score_card);
+        if (first_player < 0)
+        {
+            first_player = player_order[0];
+        }
+
+        for (const int player_index : player_order)
+        {
+            if (current_score_card.is_full())
+            {
+                break;
+            }
+
+            const Hand dice = play_turn(round, player_index, current_score_card);
+
+            // Choose the category once, so the logged and the filled category are the same
+            const optional<Category> scored_category = current_score_card.get_scoring_category(dice);
+            if (scored_category.has_value())
+            {
+                const int points = get_score(dice, scored_category.value());
+                log(MoveType::Score, round, player_index, 0, dice, scored_category, points);
+                current_score_card = current_score_card.add_entry(scored_category.value(), points, player_index, round);
+            }
+        }
+
+        return current_score_card;
+    }
+
+
+/* *********************************************************************
+Function Name: play_turn
+Purpose: To play a single turn of up to three rolls for one player without any console I/O.
+Parameters:
+            round, an integer. It is the current round number.
+            player_index, an integer. It is the index of the player taking the turn.
+            score_card, a ScoreCard passed by reference. It is the scorecard the player decides against.
+Return Value: A Hand of the five final dice.
+Algorithm:
+            1) Roll the dice that are not kept from the engine's dice source.
+            2) On the third roll, keep everything and end the turn.
+            3) Otherwise ask the player policy whether to stand; if so, keep everything.
+            4) Otherwise ask the player policy which dice to keep and add them to the kept dice.
+            5) End the turn early once all five dice are kept.
+            6) Count the turn's allocations in the engine's turn tally.
+Reference: none
+********************************************************************* */
+    Hand play_turn(const int round, const int player_index, const ScoreCard &score_card)
+    {
+        TRACE_SPAN("GameEngine::play_turn");
+        const AllocationScope allocation_scope(turn_allocations);
+        const shared_ptr<Player> &player = players[player_index];
+        Hand kept_dice;
+
+        for (int current_roll = 1; current_roll <= 3; current_roll++)
+        {
+            const Hand dice_rolls = Dice::roll_hand(5 - kept_dice.size(), dice_source);
+            log(MoveType::Roll, round, player_index, current_roll, dice_rolls);
+
+            if (current_roll == 3)
+            {
+                kept_dice = kept_dice + dice_rolls;
+                break;
+            }
+
+            const int rolls_left = 3 - current_roll;
+            if (player->wants_to_stand(score_card, kept_dice, dice_rolls, rolls_left))
+            {
+                log(MoveType::Stand, round, player_index, current_roll, dice_rolls);
+                kept_dice = kept_dice + dice_rolls;
+                break;
+            }
+
+            const Hand dice_to_keep = player->get_dice_to_keep(score_card, dice_rolls, kept_dice, rolls_left);
+            log(MoveType::Keep, round, player_index, current_roll, dice_to_keep);
+            kept_dice = kept_dice + dice_to_keep;
+
+            if (kept_dice.size() == 5)
+            {
+                break;
+            }
+        }
+
+        return kept_dice;
+    }
+
+
+/* *********************************************************************
+Function Name: get_player_order
+Purpose: To decide the turn order for a round.
+Parameters:
+            score_card, a ScoreCard passed by reference. It holds the current scores.
+Return Value: The two player indices in the order they take their turns.
+Algorithm:
+            1) Compare the two players' scores; the lower score goes first.
+            2) On a tie, both players toss a die until one rolls higher; the higher roll goes first.
+Reference: none
+********************************************************************* */
+    array<int, 2> get_player_order(const ScoreCard &score_card)
+    {
+        const int first_score = score_card.get_player_score(0);
+        const int second_score = score_card.get_player_score(1);
+
+        if (first_score < second_score)
+        {
+            return {0, 1};
+        }
+        if (second_score < first_score)
+        {
+            return {1, 0};
+        }
+
+        while (true)
+        {
+            const int first_roll = dice_source.roll_die();
+            const int second_roll = dice_source.roll_die();
+            if (first_roll != second_roll)
+            {
+                return first_roll > second_roll ? array<int, 2>{0, 1} : array<int, 2>{1, 0};
+            }
+        }
+    }
+
+
+/* *********************************************************************
+Function Name: log
+Purpose: To append a move to the move log if move recording is enabled.
+Parameters:
+            type, a MoveType. It is the kind of move.
+            round, player, roll_number, integers. They locate the move in the game.
+            dice, a Hand passed by reference. It holds the dice involved in the move.
+            category, an optional Category. It is the filled category for Score moves.
+            points, an integer. It is the points scored for Score moves.
+Return Value: None
+Algorithm:
+            1) Return immediately if moves are not being recorded.
+            2) Otherwise append the move to the log.
+Reference: none
+********************************************************************* */
+    void log(const MoveType type, const int round, const int player, const int roll_number,
+             const Hand &dice, const optional<Category> category = nullopt, const int points = 0)
+    {
+        if (!record_moves)
+        {
+            return;
+        }
+        moves.push_back(Move{type, round, player, roll_number, dice, category, points});
+    }
+};
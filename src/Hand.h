@@ -0,0 +1,347 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+
+#include "DiceEnumeration.h"
+#include "ScoreTable.h"
+
+using namespace std;
+
+// A multiset of dice values stored as a face-count histogram packed into one 32-bit word.
+// Face f (1 to 6) owns the 4-bit lane at bits 4 * (f - 1). Hands hold at most 5 dice, so
+// the lanes never overflow, and the order the dice were rolled in is not kept.
+class Hand
+{
+public:
+    // Constructor: an empty hand
+    constexpr Hand() : packed(0)
+    {
+    }
+
+    // Constructor: a hand from a list of dice values, e.g. Hand{1, 3, 3}
+    constexpr Hand(const initializer_list<int> dice) : packed(0)
+    {
+        for (const int die : dice)
+        {
+            packed += lane(die);
+        }
+    }
+
+/* *********************************************************************
+Function Name: Hand (Constructor)
+Purpose: To build a hand from a vector of dice values.
+Parameters:
+            dice, a vector of integers passed by reference. It holds dice values from 1 to 6 in any order.
+Return Value: None
+Algorithm:
+            1) Throw if there are more than five dice.
+            2) Add one to the lane of every die, throwing on a value outside 1 to 6.
+Reference: none
+********************************************************************* */
+    explicit Hand(const vector<int> &dice) : packed(0)
+    {
+        if (dice.size() > 5)
+        {
+            throw invalid_argument("A hand holds at most five dice");
+        }
+        for (const int die : dice)
+        {
+            if (die < 1 || die > 6)
+            {
+                throw invalid_argument("Dice values must be from 1 to 6");
+            }
+            packed += lane(die);
+        }
+    }
+
+    // Builds a hand directly from its packed representation
+    static constexpr Hand from_bits(const uint32_t bits)
+    {
+        Hand hand;
+        hand.packed = bits;
+        return hand;
+    }
+
+    // The packed face-count histogram
+    constexpr uint32_t bits() const
+    {
+        return packed;
+    }
+
+    // Number of dice showing the given face
+    constexpr int count(const int face) const
+    {
+        return (packed >> (4 * (face - 1))) & 0xF;
+    }
+
+    // Total number of dice; the multiply adds all six lanes into the top lane
+    constexpr int size() const
+    {
+        return ((packed * 0x111111u) >> 20) & 0xF;
+    }
+
+    constexpr bool empty() const
+    {
+        return packed == 0;
+    }
+
+    // Sum of all dice values
+    constexpr int sum() const
+    {
+        int total = 0;
+        for (int face = 1; face <= 6; face++)
+        {
+            total += count(face) * face;
+        }
+        return total;
+    }
+
+    // Highest number of dice showing the same face
+    constexpr int max_count() const
+    {
+        int max = 0;
+        for (int face = 1; face <= 6; face++)
+        {
+            max = count(face) > max ? count(face) : max;
+        }
+        return max;
+    }
+
+    // Number of different faces in the hand
+    constexpr int count_unique() const
+    {
+        return unique().size();
+    }
+
+    // Face-presence byte: bit f - 1 is set when face f shows on at least one die
+    constexpr uint8_t faces() const
+    {
+        return gather_lanes(unique().packed);
+    }
+
+    // Face-presence byte of the faces shown on at least n dice, n from 0 to 8
+    constexpr uint8_t faces_with_at_least(const int n) const
+    {
+        // Adding 8 - n to every lane carries into its guard bit exactly when the count is at least n
+        return gather_lanes(((packed + (8 - n) * LANE_ONES) >> 3) & LANE_ONES);
+    }
+
+    // Face-presence byte of the faces shown on exactly n dice
+    constexpr uint8_t faces_with_exactly(const int n) const
+    {
+        // A lane is zero after the XOR exactly when it held n
+        const uint32_t diff = packed ^ (n * LANE_ONES);
+        return gather_lanes(~(diff | (diff >> 1) | (diff >> 2) | (diff >> 3)) & LANE_ONES);
+    }
+
+    // One die of every face present in the hand
+    constexpr Hand unique() const
+    {
+        // Fold every non-zero lane down to its lowest bit
+        const uint32_t present = (packed | (packed >> 1) | (packed >> 2) | (packed >> 3)) & 0x111111u;
+        return from_bits(present);
+    }
+
+    // The hand with one more die showing face
+    constexpr Hand add(const int face) const
+    {
+        return from_bits(packed + lane(face));
+    }
+
+    // The hand with one die showing face removed; the face must be present
+    constexpr Hand remove(const int face) const
+    {
+        return from_bits(packed - lane(face));
+    }
+
+    // Whether every die of other is also in this hand (multiset subset)
+    constexpr bool contains(const Hand &other) const
+    {
+        // A lane borrows out of its guard bit exactly when other has more of that face
+        return (((packed | GUARDS) - other.packed) & GUARDS) == GUARDS;
+    }
+
+    // Dice of both hands together, like concatenating the dice vectors
+    constexpr Hand operator+(const Hand &other) const
+    {
+        return from_bits(packed + other.packed);
+    }
+
+    // Dice of this hand that are not matched by a die in other (saturating per face)
+    constexpr Hand difference(const Hand &other) const
+    {
+        const uint32_t diff = (packed | GUARDS) - other.packed;
+        // Lanes whose guard survived did not go negative; widen each surviving guard to a lane mask
+        const uint32_t keep = ((diff & GUARDS) >> 3) * 0xF;
+        return from_bits(diff & ~GUARDS & keep);
+    }
+
+    // Dice present in both hands (minimum count per face)
+    constexpr Hand intersection(const Hand &other) const
+    {
+        return from_bits(packed - difference(other).packed);
+    }
+
+    // Compact index of a five-dice hand in 0..251, the row of HAND_SCORES
+    constexpr int id() const
+    {
+        int counts[7] = {0, count(1), count(2), count(3), count(4), count(5), count(6)};
+        return hand_id(counts);
+    }
+
+    constexpr bool operator==(const Hand &other) const
+    {
+        return packed == other.packed;
+    }
+
+    constexpr bool operator!=(const Hand &other) const
+    {
+        return packed != other.packed;
+    }
+
+    // Orders hands by their packed value so they can be used as map keys
+    constexpr bool operator<(const Hand &other) const
+    {
+        return packed < other.packed;
+    }
+
+/* *********************************************************************
+Function Name: to_vector
+Purpose: To list the dice of the hand.
+Parameters: None
+Return Value: A vector of the dice values in ascending order.
+Algorithm:
+            1) For each face from 1 to 6, append the face once per die showing it.
+Reference: none
+********************************************************************* */
+    vector<int> to_vector() const
+    {
+        vector<int> dice;
+        dice.reserve(size());
+        for (int face = 1; face <= 6; face++)
+        {
+            dice.insert(dice.end(), count(face), face);
+        }
+        return dice;
+    }
+
+private:
+    // Guard bit of every lane; counts stay below 8 so the top bit of a lane is free
+    static constexpr uint32_t GUARDS = 0x888888u;
+
+    // Lowest bit of every lane
+    static constexpr uint32_t LANE_ONES = 0x111111u;
+
+    uint32_t packed;
+
+    static constexpr uint32_t lane(const int face)
+    {
+        return 1u << (4 * (face - 1));
+    }
+
+    // Packs the lowest bit of every lane (bits 0, 4, ..., 20) into bits 0 to 5
+    static constexpr uint8_t gather_lanes(uint32_t bits)
+    {
+        bits = (bits | (bits >> 3)) & 0x30303u;
+        bits = (bits | (bits >> 6)) & 0x30F0Fu;
+        return static_cast<uint8_t>((bits | (bits >> 12)) & 0x3Fu);
+    }
+};
+
+// The hand with no dice
+constexpr Hand EMPTY_HAND = Hand();
+
+
+/* *********************************************************************
+Function Name: build_all_hands
+Purpose: To turn every roll of DICE_COMBINATIONS into a hand, at compile time.
+Parameters: None
+Return Value: The 462 hands of 0 to 5 dice, in DICE_COMBINATIONS order.
+Algorithm:
+            1) For each number of dice, add the dice of each of its rows to an empty hand.
+Reference: none
+********************************************************************* */
+constexpr array<Hand, NUM_DICE_COMBINATIONS> build_all_hands()
+{
+    array<Hand, NUM_DICE_COMBINATIONS> hands{};
+    for (int size = 0; size <= 5; size++)
+    {
+        for (int row = DICE_COMBINATIONS.first_row[size]; row < DICE_COMBINATIONS.first_row[size + 1]; row++)
+        {
+            Hand hand;
+            for (int d = 0; d < size; d++)
+            {
+                hand = hand.add(DICE_COMBINATIONS.rows[row][d]);
+            }
+            hands[row] = hand;
+        }
+    }
+    return hands;
+}
+
+
+// Every hand of 0 to 5 dice, ordered by size and then by its dice in ascending order; this is the
+// order of hand_index and TurnSolver::index
+inline constexpr array<Hand, NUM_DICE_COMBINATIONS> ALL_HANDS = build_all_hands();
+
+// A read-only view of consecutive hands of ALL_HANDS
+class HandRange
+{
+public:
+    constexpr HandRange(const Hand *first, const Hand *last) : first(first), last(last)
+    {
+    }
+
+    constexpr const Hand *begin() const
+    {
+        return first;
+    }
+
+    constexpr const Hand *end() const
+    {
+        return last;
+    }
+
+    constexpr int size() const
+    {
+        return static_cast<int>(last - first);
+    }
+
+    constexpr const Hand &operator[](const int i) const
+    {
+        return first[i];
+    }
+
+private:
+    const Hand *first;
+    const Hand *last;
+};
+
+
+/* *********************************************************************
+Function Name: hand_combinations
+Purpose: To get every distinct roll of n dice (ignoring order) as hands.
+Parameters:
+            n, an integer from 0 to 5. It is the number of dice rolled.
+Return Value: A view of the hands of ALL_HANDS with n dice, in the same order as dice_combinations(n).
+Algorithm:
+            1) Return the range of ALL_HANDS that DICE_COMBINATIONS gives the rolls of n dice.
+Reference: none
+********************************************************************* */
+constexpr HandRange hand_combinations(const int n)
+{
+    return HandRange(ALL_HANDS.data() + DICE_COMBINATIONS.first_row[n],
+                     ALL_HANDS.data() + DICE_COMBINATIONS.first_row[n + 1]);
+}
@@ -0,0 +1,520 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "BinarySave.h"
+#include "Crc32.h"
+#include "Hand.h"
+#include "ScoreCard.h"
+
+using namespace std;
+
+// The kind of event a journal record holds
+enum class JournalEvent : uint8_t
+{
+    Roll = 1,
+    Keep = 2,
+    Stand = 3,
+
+    // End of a turn; the category is 0 when no category could be filled
+    Score = 4,
+    RoundEnd = 5
+};
+
+// Size in bytes of the journal header: magic, version, then the binary save the game started from
+constexpr size_t JOURNAL_HEADER_SIZE = 16 + BINARY_SAVE_SIZE;
+
+// Size in bytes of one journal record
+constexpr size_t JOURNAL_RECORD_SIZE = 16;
+
+// Struct to hold one decoded journal record. On disk a record is 16 little-endian bytes:
+//     byte 0 event, byte 1 player index, bytes 2-3 round, byte 4 roll number, byte 5 category,
+//     byte 6 points, byte 7 zero, bytes 8-11 Hand::bits() of the dice, bytes 12-15 CRC-32 of bytes 0-11
+struct JournalRecord
+{
+    JournalEvent event;
+    int player;
+    int round;
+    int roll_number;
+    int category;
+    int points;
+    Hand dice;
+};
+
+// Struct to hold the game rebuilt from a journal
+struct RecoveredGame
+{
+    ScoreCard score_card;
+    int round;
+
+    // Indices of the players who already finished their turn in this round
+    vector<int> finished_players;
+
+    // Bytes of the journal up to the last intact record; anything after it is a torn write
+    size_t valid_size;
+};
+
+// Append-only journal of every roll, keep, stand and category assignment of an interactive game.
+// Records are fixed-size and buffered in memory; the buffer is written when it fills up and written
+// and fsynced at the end of every sync_interval turns, so a crash loses at most the turns since the
+// last sync. Recovery replays the records on top of the game the journal started from.
+class Journal
+{
+public:
+    static constexpr char MAGIC[4] = {'Y', 'J', 'N', 'L'};
+    static constexpr uint32_t VERSION = 1;
+
+/* *********************************************************************
+Function Name: Journal (Constructor)
+Purpose: To open a journal for appending, creating it if needed.
+Parameters:
+            path, a string passed by reference. It is the path of the journal file.
+            baseline, a pointer to BINARY_SAVE_SIZE bytes. It is the game the journal starts from; it is
+                only written when the journal is new.
+            valid_size, the number of intact bytes of an existing journal (from recover); the file is cut
+                back to it so new records never follow a torn one. 0 for a new journal.
+            sync_interval, an integer. It is the number of turns between fsyncs.
+Return Value: None
+Algorithm:
+            1) Open the file for writing, creating it if it does not exist.
+            2) For a new journal, write the header and baseline and sync them.
+            3) For an existing journal, truncate it to its intact size and append after it.
+Reference: none
+********************************************************************* */
+    Journal(const string &path, const uint8_t *baseline, const size_t valid_size = 0, const int sync_interval = 1)
+        : sync_interval(sync_interval)
+    {
+#ifdef _WIN32
+        fd = _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_BINARY, 0644);
+#else
+        fd = open(path.c_str(), O_WRONLY | O_CREAT, 0644);
+#endif
+        if (fd < 0)
+        {
+            throw runtime_error("Could not open journal " + path);
+        }
+
+        try
+        {
+            if (valid_size == 0)
+            {
+                resize_file(0);
+                uint8_t header[JOURNAL_HEADER_SIZE] = {};
+                memcpy(header, MAGIC, sizeof(MAGIC));
+                write_uint32(header + 4, VERSION);
+                memcpy(header + 16, baseline, BINARY_SAVE_SIZE);
+                write_all(header, sizeof(header));
+                sync();
+            }
+            else
+            {
+                resize_file(valid_size);
+                seek_end();
+            }
+        }
+        catch (const runtime_error &)
+        {
+            close_file();
+            throw;
+        }
+    }
+
+    Journal(const Journal &) = delete;
+    Journal &operator=(const Journal &) = delete;
+
+    // Syncs what is still buffered on a best-effort basis: a destructor cannot report the failure, so
+    // every error is swallowed here. Call sync() first to find out whether the records reached the disk.
+    ~Journal()
+    {
+        try
+        {
+            sync();
+        }
+        catch (...)
+        {
+        }
+        close_file();
+    }
+
+
+/* *********************************************************************
+Function Name: start
+Purpose: To make a journal the one every interactive turn is recorded in.
+Parameters:
+            journal, a unique_ptr to the journal; nullptr stops journaling.
+Return Value: None
+Algorithm:
+            1) Replace the active journal, syncing and closing the previous one.
+Reference: none
+********************************************************************* */
+    static void start(unique_ptr<Journal> journal)
+    {
+        active_journal() = move(journal);
+    }
+
+
+    // The active journal, or nullptr if the game is not journaled
+    static Journal *active()
+    {
+        return active_journal().get();
+    }
+
+
+/* *********************************************************************
+Function Name: begin_turn
+Purpose: To set the round and player that the following records belong to.
+Parameters:
+            round, an integer. It is the current round.
+            player, an integer. It is the index of the player taking the turn.
+Return Value: None
+Algorithm:
+            1) Remember the round and player for record_dice and record_score.
+Reference: none
+********************************************************************* */
+    void begin_turn(const int round, const int player)
+    {
+        turn_round = round;
+        turn_player = player;
+    }
+
+
+/* *********************************************************************
+Function Name: record_dice
+Purpose: To record a roll, keep or stand of the current turn.
+Parameters:
+            event, a JournalEvent. It is Roll, Keep or Stand.
+            roll_number, an integer. It is the roll of the turn (1 to 3).
+            dice, a Hand. It holds the rolled, kept or final dice.
+Return Value: None
+Algorithm:
+            1) Append the record to the buffer.
+Reference: none
+********************************************************************* */
+    void record_dice(const JournalEvent event, const int roll_number, const Hand &dice)
+    {
+        append(JournalRecord{event, turn_player, turn_round, roll_number, 0, 0, dice});
+    }
+
+
+/* *********************************************************************
+Function Name: record_score
+Purpose: To record the end of the current turn and the category it filled.
+Parameters:
+            category, an optional Category. It is the filled category, or nullopt if none applied.
+            points, an integer. It is the points scored.
+            dice, a Hand. It holds the final dice.
+Return Value: None
+Algorithm:
+            1) Append the record to the buffer.
+            2) Sync if sync_interval turns ended since the last sync.
+Reference: none
+********************************************************************* */
+    void record_score(const optional<Category> category, const int points, const Hand &dice)
+    {
+        const int category_value = category.has_value() ? static_cast<int>(category.value()) : 0;
+        append(JournalRecord{JournalEvent::Score, turn_player, turn_round, 0, category_value, points, dice});
+
+        turns_since_sync++;
+        if (turns_since_sync >= sync_interval)
+        {
+            sync();
+        }
+    }
+
+
+/* *********************************************************************
+Function Name: record_round_end
+Purpose: To record that every player finished the round.
+Parameters:
+            round, an integer. It is the round that ended.
+Return Value: None
+Algorithm:
+            1) Append the record and sync, so a saved game and its journal always agree.
+Reference: none
+********************************************************************* */
+    void record_round_end(const int round)
+    {
+        append(JournalRecord{JournalEvent::RoundEnd, 0, round, 0, 0, 0, EMPTY_HAND});
+        sync();
+    }
+
+
+/* *********************************************************************
+Function Name: sync
+Purpose: To make every buffered record durable.
+Parameters: None
+Return Value: None
+Algorithm:
+            1) Write the buffered records to the file.
+            2) fsync the file; throw if it fails, because the records may then not be durable.
+Reference: none
+********************************************************************* */
+    void sync()
+    {
+        flush();
+#ifdef _WIN32
+        const int result = _commit(fd);
+#else
+        const int result = fsync(fd);
+#endif
+        if (result != 0)
+        {
+            throw runtime_error("Could not sync the journal");
+        }
+        turns_since_sync = 0;
+    }
+
+
+/* *********************************************************************
+Function Name: recover
+Purpose: To rebuild a game from a journal.
+Parameters:
+            path, a string passed by reference. It is the path of the journal file.
+Return Value: The RecoveredGame.
+Algorithm:
+            1) Read the file and check the header; throw if it is not a journal.
+            2) Decode the baseline game.
+            3) Replay the records in order until the end of the file, the first torn record or the first
+               record the scorecard rejects:
+                a) A Score record fills its category and marks its player as finished for the round.
+                b) A RoundEnd record moves to the next round.
+            4) Return the scorecard, the round, the players already finished and the intact size.
+Reference: none
+********************************************************************* */
+    static RecoveredGame recover(const string &path)
+    {
+        ifstream file(path, ios::binary);
+        if (!file)
+        {
+            throw runtime_error("Could not open journal " + path);
+        }
+        const vector<uint8_t> bytes((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+        if (bytes.size() < JOURNAL_HEADER_SIZE || memcmp(bytes.data(), MAGIC, sizeof(MAGIC)) != 0)
+        {
+            throw runtime_error("Not a journal: " + path);
+        }
+        if (read_uint32(bytes.data() + 4) != VERSION)
+        {
+            throw runtime_error("Unsupported journal version: " + path);
+        }
+
+        RecoveredGame game{ScoreCard(), 1, {}, JOURNAL_HEADER_SIZE};
+        game.score_card = BinarySave::decode(bytes.data() + 16, BINARY_SAVE_SIZE, game.round);
+
+        JournalRecord record{};
+        while (game.valid_size + JOURNAL_RECORD_SIZE <= bytes.size() &&
+               decode_record(bytes.data() + game.valid_size, record))
+        {
+            if (record.event == JournalEvent::Score)
+            {
+                // A record with a valid CRC the scorecard rejects (a category filled twice, say) ends the
+                // intact part of the journal just like a torn record does
+                if (record.category != 0)
+                {
+                    try
+                    {
+                        game.score_card = game.score_card.add_entry(static_cast<Category>(record.category),
+                                                                    record.points, record.player, record.round);
+                    }
+                    catch (const invalid_argument &)
+                    {
+                        break;
+                    }
+                }
+                game.finished_players.push_back(record.player);
+            }
+            else if (record.event == JournalEvent::RoundEnd)
+            {
+                game.round = record.round + 1;
+                game.finished_players.clear();
+            }
+            game.valid_size += JOURNAL_RECORD_SIZE;
+        }
+        return game;
+    }
+
+
+/* *********************************************************************
+Function Name: encode_record
+Purpose: To write a record in its 16-byte on-disk form.
+Parameters:
+            record, a JournalRecord passed by reference.
+            out, a pointer to JOURNAL_RECORD_SIZE bytes.
+Return Value: None
+Algorithm:
+            1) Write every field at its offset and append the CRC-32 of the first 12 bytes.
+Reference: none
+********************************************************************* */
+    static void encode_record(const JournalRecord &record, uint8_t *out)
+    {
+        out[0] = static_cast<uint8_t>(record.event);
+        out[1] = static_cast<uint8_t>(record.player);
+        out[2] = static_cast<uint8_t>(record.round);
+        out[3] = static_cast<uint8_t>(record.round >> 8);
+        out[4] = static_cast<uint8_t>(record.roll_number);
+        out[5] = static_cast<uint8_t>(record.category);
+        out[6] = static_cast<uint8_t>(record.points);
+        out[7] = 0;
+        write_uint32(out + 8, record.dice.bits());
+        write_uint32(out + 12, crc32(out, 12));
+    }
+
+
+/* *********************************************************************
+Function Name: decode_record
+Purpose: To read a record from its 16-byte on-disk form.
+Parameters:
+            data, a pointer to JOURNAL_RECORD_SIZE bytes.
+            record, a JournalRecord passed by reference. It receives the record.
+Return Value: true if the record is intact and valid, false if it is torn or corrupt.
+Algorithm:
+            1) Check the checksum, the event, the player, the category, the points and the dice.
+            2) Read every field from its offset.
+Reference: none
+********************************************************************* */
+    static bool decode_record(const uint8_t *data, JournalRecord &record)
+    {
+        if (read_uint32(data + 12) != crc32(data, 12))
+        {
+            return false;
+        }
+        const Hand dice = Hand::from_bits(read_uint32(data + 8));
+        if (data[0] < static_cast<uint8_t>(JournalEvent::Roll) || data[0] > static_cast<uint8_t>(JournalEvent::RoundEnd) ||
+            data[1] > 1 || data[5] > NUM_CATEGORIES || data[6] > 50 || (dice.bits() & ~0x777777u) != 0 || dice.size() > 5)
+        {
+            return false;
+        }
+        record = JournalRecord{static_cast<JournalEvent>(data[0]), data[1], data[2] | (data[3] << 8), data[4],
+                               data[5], data[6], dice};
+        return true;
+    }
+
+
+private:
+    // Number of records buffered before they are written without waiting for a sync
+    static constexpr size_t BUFFER_RECORDS = 256;
+
+    int fd;
+    const int sync_interval;
+    int turns_since_sync = 0;
+    int turn_round = 0;
+    int turn_player = 0;
+    array<uint8_t, BUFFER_RECORDS * JOURNAL_RECORD_SIZE> buffer{};
+    size_t buffered = 0;
+
+    static unique_ptr<Journal> &active_journal()
+    {
+        static unique_ptr<Journal> journal;
+        return journal;
+    }
+
+    // Encodes a record into the buffer, writing the buffer out first if it is full
+    void append(const JournalRecord &record)
+    {
+        if (buffered + JOURNAL_RECORD_SIZE > buffer.size())
+        {
+            flush();
+        }
+        encode_record(record, buffer.data() + buffered);
+        buffered += JOURNAL_RECORD_SIZE;
+    }
+
+    // Writes the buffered records to the file
+    void flush()
+    {
+        write_all(buffer.data(), buffered);
+        buffered = 0;
+    }
+
+    void write_all(const uint8_t *data, size_t size)
+    {
+        while (size > 0)
+        {
+#ifdef _WIN32
+            const int written = _write(fd, data, static_cast<unsigned>(size));
+#else
+            const ssize_t written = write(fd, data, size);
+#endif
+            if (written <= 0)
+            {
+                throw runtime_error("Could not write to the journal");
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+    }
+
+    void resize_file(const size_t size)
+    {
+#ifdef _WIN32
+        const int result = _chsize_s(fd, static_cast<long long>(size));
+#else
+        const int result = ftruncate(fd, static_cast<off_t>(size));
+#endif
+        if (result != 0)
+        {
+            throw runtime_error("Could not truncate the journal");
+        }
+    }
+
+    void seek_end()
+    {
+#ifdef _WIN32
+        const bool failed = _lseeki64(fd, 0, SEEK_END) < 0;
+#else
+        const bool failed = lseek(fd, 0, SEEK_END) < 0;
+#endif
+        if (failed)
+        {
+            throw runtime_error("Could not seek to the end of the journal");
+        }
+    }
+
+    void close_file()
+    {
+#ifdef _WIN32
+        _close(fd);
+#else
+        close(fd);
+#endif
+    }
+
+    static void write_uint32(uint8_t *out, const uint32_t value)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            out[i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+    }
+
+    static uint32_t read_uint32(const uint8_t *data)
+    {
+        return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+               (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+    }
+};
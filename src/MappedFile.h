@@ -0,0 +1,115 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// A whole file memory-mapped read-only, so readers can use its bytes in place without parsing
+// or copying them. On Windows the file is read into memory instead.
+class MappedFile
+{
+public:
+/* *********************************************************************
+Function Name: MappedFile (Constructor)
+Purpose: To map a file read-only.
+Parameters:
+            path, a string passed by reference. It is the path of the file.
+            kind, a string passed by reference. It names the kind of file in error messages.
+Return Value: None
+Algorithm:
+            1) Open the file and read its size; throw if it cannot be opened or is empty.
+            2) Map the whole file read-only (read it into memory on Windows); throw if that fails.
+Reference: none
+********************************************************************* */
+    MappedFile(const string &path, const string &kind)
+    {
+#ifdef _WIN32
+        ifstream file(path, ios::binary);
+        if (!file)
+        {
+            throw runtime_error("Could not open " + kind + " " + path);
+        }
+        contents.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+        if (contents.empty())
+        {
+            throw runtime_error("Could not read " + kind + " " + path);
+        }
+        bytes = reinterpret_cast<const uint8_t *>(contents.data());
+        length = contents.size();
+#else
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw runtime_error("Could not open " + kind + " " + path);
+        }
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+        {
+            close(fd);
+            throw runtime_error("Could not read " + kind + " " + path);
+        }
+        length = static_cast<size_t>(file_stat.st_size);
+        void *mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapped == MAP_FAILED)
+        {
+            throw runtime_error("Could not map " + kind + " " + path);
+        }
+        bytes = static_cast<const uint8_t *>(mapped);
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        munmap(const_cast<uint8_t *>(bytes), length);
+#endif
+    }
+
+
+    // The first byte of the file
+    const uint8_t *data() const
+    {
+        return bytes;
+    }
+
+
+    // The number of bytes in the file
+    size_t size() const
+    {
+        return length;
+    }
+
+
+private:
+    const uint8_t *bytes = nullptr;
+    size_t length = 0;
+#ifdef _WIN32
+    vector<char> contents;
+#endif
+};
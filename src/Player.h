@@ -8,11 +8,15 @@
 */
 #pragma once
 
+#include <map>
+#include <memory>
 #include <string>
 #include <optional>
 
 #include "Dice.h"
+#include "Hand.h"
 #include "Reason.h"
+#include "Trace.h"
 #include "io_functions.h"
 
 using namespace std;
@@ -167,15 +171,16 @@ Function Name: get_dice_roll
 Purpose: To get a specified number of dice rolls from the user
 Parameters:
             num_dice, an integer passed by value. It specifies how many dice should be rolled
-Return Value: A vector of integers representing the results of the dice rolls
+Return Value: A Hand holding the results of the dice rolls
 Algorithm:
             1) Call the helpers::get_dice_roll function with the specified number of dice
-            2) Return the vector of dice rolls
+            2) Return the dice rolls as a Hand
 Reference: None
 ********************************************************************* */
-    virtual vector<int> get_dice_roll(const int num_dice)
+    virtual Hand get_dice_roll(const int num_dice)
     {
-        return helpers::get_dice_roll(num_dice);
+        TRACE_SPAN("Player::get_dice_roll");
+        return Hand(helpers::get_dice_roll(num_dice));
     }
 
 
@@ -184,22 +189,24 @@ Function Name: get_dice_to_keep
 Purpose: To determine which dice the player wants to keep after rolling
 Parameters:
             score_card, a constant reference to a ScoreCard object. It provides the current state of the game
-            dice_rolls, a vector of integers passed by value. It contains the current dice roll results
-            kept_dice, a vector of integers passed by value. It holds the dice that the player has chosen to keep
-Return Value: A vector of integers representing the dice the player wants to keep
+            dice_rolls, a Hand passed by reference. It contains the current dice roll results
+            kept_dice, a Hand passed by reference. It holds the dice that the player has chosen to keep
+            rolls_left, an integer. It is the number of rolls still allowed after this one
+Return Value: A Hand holding the dice the player wants to keep
 Algorithm:
             1) Display the kept dice to the player
             2) Display the current dice rolls to the player
             3) Call helpers::get_dice_to_keep to get the player's decision on which dice to keep
-            4) Return the vector of dice to keep
+            4) Return the dice to keep as a Hand
 Reference: None
 ********************************************************************* */
-    virtual vector<int> get_dice_to_keep(const ScoreCard &score_card, const vector<int> &dice_rolls,
-                                         const vector<int> &kept_dice)
+    virtual Hand get_dice_to_keep(const ScoreCard &score_card, const Hand &dice_rolls, const Hand &kept_dice,
+                                  [[maybe_unused]] const int rolls_left)
     {
-        show_message("Kept dice: " + to_string_vector(kept_dice));
-        show_message("Current dice rolls: " + to_string_vector(dice_rolls));
-        return helpers::get_dice_to_keep(dice_rolls);
+        TRACE_SPAN("Player::get_dice_to_keep");
+        show_message("Kept dice: " + to_string_hand(kept_dice));
+        show_message("Current dice rolls: " + to_string_hand(dice_rolls));
+        return Hand(helpers::get_dice_to_keep(dice_rolls.to_vector()));
     }
 
 
@@ -208,16 +215,17 @@ Function Name: get_category_pursuits
 Purpose: To determine the categories that the player wants to pursue based on kept dice
 Parameters:
             score_card, a constant reference to a ScoreCard object. It provides the current state of the game
-            kept_dice, a vector of integers passed by value. It holds the dice that the player has chosen to keep
-Return Value: An optional map of categories and reasons for pursuing them
+            kept_dice, a Hand passed by reference. It holds the dice that the player has chosen to keep
+Return Value: A shared_ptr to the map of categories and reasons for pursuing them, or nullptr if the
+              player does not report pursuits
 Algorithm:
-            1) Return nullopt as the default behavior for the Player class
+            1) Return nullptr as the default behavior for the Player class
 Reference: None
 ********************************************************************* */
-    virtual optional<map<Category, Reason>> get_category_pursuits(const ScoreCard &score_card,
-                                                                  const vector<int> &kept_dice)
+    virtual shared_ptr<const map<Category, Reason>> get_category_pursuits(const ScoreCard &score_card,
+                                                                          const Hand &kept_dice)
     {
-        return nullopt;
+        return nullptr;
     }
 
 
@@ -226,14 +234,13 @@ Function Name: get_target
 Purpose: To determine the target category for scoring based on kept dice
 Parameters:
             score_card, a constant reference to a ScoreCard object. It provides the current state of the game
-            kept_dice, a vector of integers passed by value. It holds the dice that the player has chosen to keep
+            kept_dice, a Hand passed by reference. It holds the dice that the player has chosen to keep
 Return Value: An optional pair containing the target category and the corresponding dice
 Algorithm:
             1) Return nullopt as the default behavior for the Player class
 Reference: None
 ********************************************************************* */
-    virtual optional<pair<Category, vector<int>>> get_target(const ScoreCard &score_card,
-                                                             const vector<int> &kept_dice)
+    virtual optional<pair<Category, Hand>> get_target(const ScoreCard &score_card, const Hand &kept_dice)
     {
         return nullopt;
     }
@@ -244,8 +251,9 @@ Function Name: wants_to_stand
 Purpose: To determine if the player wants to stand (keep their current choice)
 Parameters:
             score_card, a constant reference to a ScoreCard object. It provides the current state of the game
-            kept_dice, a vector of integers passed by value. It holds the dice that the player has chosen to keep
-            dice_rolls, a vector of integers passed by value. It contains the current dice roll results
+            kept_dice, a Hand passed by reference. It holds the dice that the player has chosen to keep
+            dice_rolls, a Hand passed by reference. It contains the current dice roll results
+            rolls_left, an integer. It is the number of rolls still allowed after this one
 Return Value: A boolean indicating whether the player wants to stand
 Algorithm:
             1) Display the kept dice to the player
@@ -253,11 +261,12 @@ Algorithm:
             3) Call helpers::wants_to_stand to get the player's decision
 Reference: None
 ********************************************************************* */
-    virtual bool wants_to_stand(const ScoreCard &score_card, const vector<int> &kept_dice,
-                                const vector<int> &dice_rolls)
+    virtual bool wants_to_stand(const ScoreCard &score_card, const Hand &kept_dice, const Hand &dice_rolls,
+                                [[maybe_unused]] const int rolls_left)
     {
-        show_message("Kept dice: " + to_string_vector(kept_dice));
-        show_message("Current dice rolls: " + to_string_vector(dice_rolls));
+        TRACE_SPAN("Player::wants_to_stand");
+        show_message("Kept dice: " + to_string_hand(kept_dice));
+        show_message("Current dice rolls: " + to_string_hand(dice_rolls));
         return helpers::wants_to_stand();
     }
 
@@ -273,6 +282,7 @@ Reference: None
 ********************************************************************* */
     virtual bool wants_help()
     {
+        TRACE_SPAN("Player::wants_help");
         return helpers::wants_help();
     }
 
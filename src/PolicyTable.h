@@ -0,0 +1,282 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Hand.h"
+#include "MappedFile.h"
+#include "TurnSolver.h"
+
+using namespace std;
+
+// Number of (kept dice, rolled dice) pairs that make up five dice, the decisions with one roll left
+constexpr int NUM_SECOND_ROLLS = 4368;
+
+// Bytes of policy stored for each open-category mask
+constexpr int POLICY_STRIDE = NUM_HANDS + NUM_SECOND_ROLLS + NUM_ALL_HANDS;
+
+// Struct at the start of a policy file
+struct PolicyHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t num_masks;
+    uint32_t stride;
+};
+
+// The Computer's decisions for every open-category mask, precomputed by tools/make_policy.cpp and
+// memory-mapped read-only. For each mask, in order, the file holds:
+//     252 bytes   keep choice on the first roll (nothing kept yet), by position of the roll in
+//                 hand_combinations(5)
+//     4368 bytes  keep choice on the second roll, by (kept dice, rolled dice) pair
+//     462 bytes   target final roll of each kept hand, by position in hand_combinations(5)
+// A keep choice is a position in TurnSolver's sub-multiset list of the roll; the last one is the whole roll.
+class PolicyTable
+{
+public:
+    static constexpr char MAGIC[4] = {'Y', 'P', 'O', 'L'};
+    static constexpr uint32_t VERSION = 2;
+
+/* *********************************************************************
+Function Name: PolicyTable (Constructor)
+Purpose: To memory-map a policy file and check that it matches this build.
+Parameters:
+            path, a string passed by reference. It is the path of the policy file.
+Return Value: None
+Algorithm:
+            1) Map the whole file read-only (read it into memory on Windows).
+            2) Throw if the file is too short, or the magic, version, mask count or stride differ.
+            3) Throw if any stored decision is out of range, so a corrupt or stale file cannot make the
+               lookups read past the solver's tables.
+Reference: none
+********************************************************************* */
+    explicit PolicyTable(const string &path) : file(path, "policy file")
+    {
+        const uint8_t *data = file.data();
+        const size_t size = file.size();
+
+        PolicyHeader header{};
+        if (size >= sizeof(header))
+        {
+            memcpy(&header, data, sizeof(header));
+        }
+        if (size != sizeof(header) + static_cast<size_t>(NUM_MASKS) * POLICY_STRIDE ||
+            memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+            header.num_masks != NUM_MASKS || header.stride != POLICY_STRIDE)
+        {
+            throw runtime_error("Invalid policy file " + path);
+        }
+        masks = data + sizeof(header);
+        if (!has_valid_decisions(masks))
+        {
+            throw runtime_error("Corrupt policy file " + path);
+        }
+    }
+
+    PolicyTable(const PolicyTable &) = delete;
+    PolicyTable &operator=(const PolicyTable &) = delete;
+
+
+/* *********************************************************************
+Function Name: load
+Purpose: To make a policy file the one every Computer player consults.
+Parameters:
+            path, a string passed by reference. It is the path of the policy file.
+Return Value: None
+Algorithm:
+            1) Map the file; the constructor throws if it is missing or invalid.
+            2) Replace the loaded table with it.
+Reference: none
+********************************************************************* */
+    static void load(const string &path)
+    {
+        loaded_table() = make_unique<PolicyTable>(path);
+    }
+
+
+    // The loaded policy table, or nullptr if none was loaded
+    static const PolicyTable *loaded()
+    {
+        return loaded_table().get();
+    }
+
+
+/* *********************************************************************
+Function Name: get_dice_to_keep
+Purpose: To look up the dice to keep from a roll.
+Parameters:
+            open_mask, a 12-bit category mask. It holds the categories that can still be filled.
+            kept_dice, a Hand. It holds the dice kept from earlier rolls.
+            dice_rolls, a Hand. It holds the dice just rolled; kept and rolled dice make five dice.
+            rolls_left, an integer. It is the number of rolls still allowed after this one.
+Return Value: The sub-multiset of dice_rolls to keep.
+Algorithm:
+            1) With no rolls left, keep everything.
+            2) With two rolls left, read the first-roll choice of the roll.
+            3) With one roll left, read the second-roll choice of the (kept, rolled) pair.
+Reference: none
+********************************************************************* */
+    Hand get_dice_to_keep(const uint16_t open_mask, const Hand &kept_dice, const Hand &dice_rolls,
+                          const int rolls_left) const
+    {
+        if (rolls_left <= 0)
+        {
+            return dice_rolls;
+        }
+        const uint8_t *policy = masks + static_cast<size_t>(open_mask) * POLICY_STRIDE;
+        if (rolls_left >= 2)
+        {
+            return TurnSolver::subset(dice_rolls, policy[position(dice_rolls)]);
+        }
+        return TurnSolver::subset(dice_rolls, policy[NUM_HANDS + second_roll_index(kept_dice, dice_rolls)]);
+    }
+
+
+/* *********************************************************************
+Function Name: get_target
+Purpose: To look up the final roll the Computer aims for with some dice kept.
+Parameters:
+            open_mask, a 12-bit category mask. It holds the categories that can still be filled.
+            kept_dice, a Hand. It holds the dice kept so far.
+Return Value: The five-dice final roll, which contains kept_dice.
+Algorithm:
+            1) Read the target position of the kept hand and return that five-dice hand.
+Reference: none
+********************************************************************* */
+    Hand get_target(const uint16_t open_mask, const Hand &kept_dice) const
+    {
+        const uint8_t *policy = masks + static_cast<size_t>(open_mask) * POLICY_STRIDE;
+        return hand_combinations(5)[policy[NUM_HANDS + NUM_SECOND_ROLLS + TurnSolver::index(kept_dice)]];
+    }
+
+
+/* *********************************************************************
+Function Name: position
+Purpose: To get the position of a hand among the hands with the same number of dice.
+Parameters:
+            hand, a Hand of 0 to 5 dice.
+Return Value: The position of the hand in hand_combinations(hand.size()).
+Algorithm:
+            1) Subtract the number of smaller hands from the solver's index of the hand.
+Reference: none
+********************************************************************* */
+    static int position(const Hand &hand)
+    {
+        return TurnSolver::index(hand) - DICE_COMBINATIONS.first_row[hand.size()];
+    }
+
+
+/* *********************************************************************
+Function Name: second_roll_index
+Purpose: To get the index of a (kept dice, rolled dice) pair in the second-roll block.
+Parameters:
+            kept_dice, a Hand of k dice.
+            dice_rolls, a Hand of 5 - k dice.
+Return Value: An index from 0 to 4367.
+Algorithm:
+            1) Pairs are ordered by the number of kept dice, then the kept hand, then the rolled hand.
+            2) Add the pairs with fewer kept dice, the pairs with earlier kept hands and the rolled
+               hand's position.
+Reference: none
+********************************************************************* */
+    static int second_roll_index(const Hand &kept_dice, const Hand &dice_rolls)
+    {
+        // Number of pairs with fewer kept dice, for 0 to 5 kept dice
+        static constexpr int KEPT_OFFSETS[6] = {0, 252, 1008, 2184, 3360, 4116};
+        const int num_kept = kept_dice.size();
+        return KEPT_OFFSETS[num_kept] + position(kept_dice) * binomial(10 - num_kept, 5) + position(dice_rolls);
+    }
+
+
+private:
+/* *********************************************************************
+Function Name: has_valid_decisions
+Purpose: To check that every decision of a policy file can be looked up safely.
+Parameters:
+            masks, a pointer to the policy of every open-category mask.
+Return Value: true if every keep choice names a sub-multiset of its roll and every target is a
+              five-dice hand containing its kept hand, false otherwise.
+Algorithm:
+            1) Find the number of keep choices of the roll behind every keep byte of a mask.
+            2) Find the five-dice hands that contain each kept hand.
+            3) Compare every byte of every mask with its limit; a full scorecard has no targets, so only
+               check that its target bytes stay in range.
+Reference: none
+********************************************************************* */
+    static bool has_valid_decisions(const uint8_t *masks)
+    {
+        const DiceTables &tables = TurnSolver::get_tables();
+
+        array<uint8_t, NUM_HANDS + NUM_SECOND_ROLLS> num_choices{};
+        for (const Hand &dice_rolls : hand_combinations(5))
+        {
+            num_choices[position(dice_rolls)] =
+                static_cast<uint8_t>(tables.subset_radixes[TurnSolver::index(dice_rolls)].size());
+        }
+        for (int num_kept = 0; num_kept <= 5; num_kept++)
+        {
+            for (const Hand &kept_dice : hand_combinations(num_kept))
+            {
+                for (const Hand &dice_rolls : hand_combinations(5 - num_kept))
+                {
+                    num_choices[NUM_HANDS + second_roll_index(kept_dice, dice_rolls)] =
+                        static_cast<uint8_t>(tables.subset_radixes[TurnSolver::index(dice_rolls)].size());
+                }
+            }
+        }
+
+        vector<bitset<NUM_HANDS>> targets(NUM_ALL_HANDS);
+        for (int i = 0; i < NUM_ALL_HANDS; i++)
+        {
+            for (int target = 0; target < NUM_HANDS; target++)
+            {
+                targets[i][target] = hand_combinations(5)[target].contains(ALL_HANDS[i]);
+            }
+        }
+
+        for (int open_mask = 0; open_mask < NUM_MASKS; open_mask++)
+        {
+            const uint8_t *policy = masks + static_cast<size_t>(open_mask) * POLICY_STRIDE;
+            for (int i = 0; i < NUM_HANDS + NUM_SECOND_ROLLS; i++)
+            {
+                if (policy[i] >= num_choices[i])
+                {
+                    return false;
+                }
+            }
+            const uint8_t *target = policy + NUM_HANDS + NUM_SECOND_ROLLS;
+            for (int i = 0; i < NUM_ALL_HANDS; i++)
+            {
+                if (target[i] >= NUM_HANDS || (open_mask != 0 && !targets[i][target[i]]))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+
+    MappedFile file;
+    const uint8_t *masks = nullptr;
+
+    static unique_ptr<PolicyTable> &loaded_table()
+    {
+        static unique_ptr<PolicyTable> table;
+        return table;
+    }
+};
@@ -8,7 +8,7 @@
 */
 #pragma once
 
-#include <vector>
+#include "Hand.h"
 #include "ScoreCategory.h"
 
 using namespace std;
@@ -18,7 +18,7 @@ struct Reason
 {
 
     // The current dice values the player has at the moment
-    vector<int> current_dice;
+    Hand current_dice;
 
     // The category that the player is currently pursuing based on their dice
     Category pursued_category;
@@ -27,11 +27,17 @@ struct Reason
     int max_score;
 
     // The dice values the player would need to roll in order to achieve the maximum score in this category
-    vector<int> roll_to_get_max;
+    Hand roll_to_get_max;
 
     // The minimum possible score that can be achieved by pursuing this category
     int min_score;
 
     // The dice values the player would need to roll in order to achieve the minimum score in this category
-    vector<int> roll_to_get_min;
+    Hand roll_to_get_min;
+
+    // The chance that one roll of the dice that are not kept reaches the maximum score
+    double max_probability;
+
+    // The score to expect in this category after one roll of the dice that are not kept
+    double expected_score;
 };
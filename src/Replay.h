@@ -0,0 +1,184 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "Computer.h"
+#include "GameEngine.h"
+#include "ValueTable.h"
+#include "helper_functions.h"
+
+using namespace std;
+
+// Records and re-executes seeded computer-vs-computer games.
+// A replay is the seed, the value table the categories were chosen with, and the
+// ScoreCard::serialize() output it produced, e.g.
+//     Seed: 42
+//     Values: none
+//     Rounds: 14
+//     Scorecard:
+//     4 Computer2 4
+//     ...
+class Replay
+{
+public:
+/* *********************************************************************
+Function Name: play
+Purpose: To play the computer-vs-computer game determined by a seed.
+Parameters:
+            seed, an unsigned 64-bit integer. It determines every roll and tie-breaker of the game.
+Return Value: A GameResult for the seeded game.
+Algorithm:
+            1) Run a headless GameEngine of the two replay players with the seed and return its result.
+Reference: none
+********************************************************************* */
+    static GameResult play(const uint64_t seed)
+    {
+        return GameEngine(get_players(), seed, false).play();
+    }
+
+
+/* *********************************************************************
+Function Name: get_players
+Purpose: To create the players of a replayed game.
+Parameters: None
+Return Value: Two computer players with distinct names, in engine order.
+Algorithm:
+            1) Create the computers "Computer1" and "Computer2".
+Reference: none
+********************************************************************* */
+    static vector<shared_ptr<Player>> get_players()
+    {
+        return {make_shared<Computer>("Computer1"), make_shared<Computer>("Computer2")};
+    }
+
+
+/* *********************************************************************
+Function Name: record
+Purpose: To play a seeded game and produce its replay text.
+Parameters:
+            seed, an unsigned 64-bit integer. It determines the game.
+Return Value: A string containing the seed, the value table, the number of rounds and the serialized
+              final scorecard.
+Algorithm:
+            1) Play the seeded game.
+            2) Write the seed, the value table line, the round count and the serialized scorecard.
+Reference: none
+********************************************************************* */
+    static string record(const uint64_t seed)
+    {
+        return write(seed, play(seed), true);
+    }
+
+
+/* *********************************************************************
+Function Name: verify
+Purpose: To re-execute a recorded replay and check that it produces the same game.
+Parameters:
+            serial, a string passed by reference. It is the recorded replay text.
+Return Value: true if replaying the recorded seed reproduces the recorded text exactly, false otherwise.
+Algorithm:
+            1) Find the "Seed: " line and parse the seed; throw invalid_argument if it is missing or not a number.
+            2) Find the "Values: " line; a replay without one was recorded before it existed, without a table.
+               Throw invalid_argument if the loaded value table is not the one the replay was recorded with,
+               since the table changes which categories are filled.
+            3) Record the game again from that seed, with the value table line only if the replay has one.
+            4) Compare the new replay text with the recorded one, ignoring surrounding whitespace.
+Reference: none
+********************************************************************* */
+    static bool verify(const string &serial)
+    {
+        optional<uint64_t> seed;
+        optional<string> recorded_values;
+        for (const string &line : split(serial, '\n'))
+        {
+            if (!seed.has_value() && line.rfind("Seed: ", 0) == 0)
+            {
+                seed = parse_unsigned("Seed", trim(line.substr(6)));
+            }
+            else if (!recorded_values.has_value() && line.rfind("Values: ", 0) == 0)
+            {
+                recorded_values = trim(line.substr(8));
+            }
+        }
+        if (!seed.has_value())
+        {
+            throw invalid_argument("Replay does not contain a seed");
+        }
+
+        const string values = get_values_name();
+        if (recorded_values.value_or("none") != values)
+        {
+            if (recorded_values.value_or("none") == "none")
+            {
+                throw invalid_argument("Replay was recorded without a value table; run it without --values");
+            }
+            throw invalid_argument("Replay was recorded with the value table of " + recorded_values.value() +
+                                   "; run it with --values of that table");
+        }
+        return trim(write(seed.value(), play(seed.value()), recorded_values.has_value())) == trim(serial);
+    }
+
+
+private:
+/* *********************************************************************
+Function Name: get_values_name
+Purpose: To name the value table that chooses the scored categories, as written in a replay.
+Parameters: None
+Return Value: "none" without a value table, otherwise "crc32 " and the table file's CRC-32 in hex.
+Algorithm:
+            1) Format the checksum of the loaded table, if there is one.
+Reference: none
+********************************************************************* */
+    static string get_values_name()
+    {
+        const ValueTable *table = ValueTable::loaded();
+        if (table == nullptr)
+        {
+            return "none";
+        }
+        stringstream name;
+        name << "crc32 " << hex << setw(8) << setfill('0') << table->get_checksum();
+        return name.str();
+    }
+
+
+/* *********************************************************************
+Function Name: write
+Purpose: To write the replay text of a played game.
+Parameters:
+            seed, an unsigned 64-bit integer. It is the seed of the game.
+            result, a GameResult passed by reference. It is the played game.
+            with_values, a boolean. It is true to write the value table line.
+Return Value: The replay text.
+Algorithm:
+            1) Write the seed, the value table line if asked for, the round count and the serialized scorecard.
+Reference: none
+********************************************************************* */
+    static string write(const uint64_t seed, const GameResult &result, const bool with_values)
+    {
+        stringstream serial;
+        serial << "Seed: " << seed << endl;
+        if (with_values)
+        {
+            serial << "Values: " << get_values_name() << endl;
+        }
+        serial << "Rounds: " << result.rounds << endl;
+        serial << "Scorecard:" << endl;
+        serial << result.score_card.serialize(get_players());
+        return serial.str();
+    }
+};
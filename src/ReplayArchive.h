@@ -0,0 +1,477 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BinarySave.h"
+#include "GameEngine.h"
+#include "Journal.h"
+#include "MappedFile.h"
+
+using namespace std;
+
+// Struct at the start of a replay archive
+struct ArchiveHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint64_t num_games;
+
+    // Byte offset of the journal section, right after the last game record
+    uint64_t journal_offset;
+    uint64_t num_journal_records;
+    uint8_t reserved[32];
+};
+
+// Fixed-size record of one finished game. Record N of an archive is game N of the simulation that
+// wrote it, so a reader jumps to any game by offset.
+struct ArchiveRecord
+{
+    // Seed the game was played from; replaying it reproduces the game
+    uint64_t seed;
+
+    // Index of the game's first turn record in the journal section, and the number of records
+    uint64_t journal_first;
+    uint32_t journal_count;
+
+    uint16_t rounds;
+
+    // Index of the player who took the first turn
+    uint8_t first_player;
+
+    // ARCHIVE_GAME_PRESENT once the game was written
+    uint8_t flags;
+
+    // Final scorecard, in the binary save format with the last round played as its round
+    uint8_t save[BINARY_SAVE_SIZE];
+
+    uint8_t reserved[8];
+
+/* *********************************************************************
+Function Name: is_intact
+Purpose: To check that a written record can be trusted before reading it.
+Parameters: None
+Return Value: true if the first player is 0 or 1, the packed scorecard's checksum matches and every
+              category entry is one BinarySave::decode accepts.
+Algorithm:
+            1) Check the first player index.
+            2) Check the CRC-32 of the binary save.
+            3) Check every category entry, so get_winner only returns -1, 0 or 1.
+Reference: none
+********************************************************************* */
+    bool is_intact() const
+    {
+        if (first_player > 1 || !BinarySave::has_valid_checksum(save))
+        {
+            return false;
+        }
+        for (const Category category : CATEGORIES)
+        {
+            if (!BinarySave::is_valid_entry(get_entry(category)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+/* *********************************************************************
+Function Name: get_points
+Purpose: To read the points of a category straight from the packed scorecard.
+Parameters:
+            category, a Category.
+Return Value: The points scored in the category, 0 if it is open.
+Algorithm:
+            1) Read the category's 16-bit entry and return its low 6 bits.
+Reference: none
+********************************************************************* */
+    int get_points(const Category category) const
+    {
+        return get_entry(category) & 0x3F;
+    }
+
+
+/* *********************************************************************
+Function Name: get_winner
+Purpose: To read who filled a category straight from the packed scorecard.
+Parameters:
+            category, a Category.
+Return Value: The index (0 or 1) of the player who filled the category, -1 if it is open.
+Algorithm:
+            1) Read the winner bits of the category's 16-bit entry; 0 is open and 1 and 2 are the players.
+Reference: none
+********************************************************************* */
+    int get_winner(const Category category) const
+    {
+        return ((get_entry(category) >> 6) & 0x3) - 1;
+    }
+
+
+/* *********************************************************************
+Function Name: get_player_score
+Purpose: To add up a player's final score straight from the packed scorecard.
+Parameters:
+            player, an integer. It is the index (0 or 1) of the player.
+Return Value: The player's total points.
+Algorithm:
+            1) Add the points of every category the player filled.
+Reference: none
+********************************************************************* */
+    int get_player_score(const int player) const
+    {
+        int score = 0;
+        for (const Category category : CATEGORIES)
+        {
+            if (get_winner(category) == player)
+            {
+                score += get_points(category);
+            }
+        }
+        return score;
+    }
+
+
+private:
+    uint16_t get_entry(const Category category) const
+    {
+        const int i = static_cast<int>(category) - 1;
+        return static_cast<uint16_t>(save[4 + 2 * i] | (save[5 + 2 * i] << 8));
+    }
+};
+
+static_assert(sizeof(ArchiveHeader) == 64, "ArchiveHeader must stay 64 bytes");
+static_assert(sizeof(ArchiveRecord) == 64, "ArchiveRecord must stay 64 bytes");
+
+// Flag of a record that holds a game; records of games that were never written stay zero
+constexpr uint8_t ARCHIVE_GAME_PRESENT = 1;
+
+// Games buffered by one simulation worker before they are written to the archive together
+struct ArchiveBatch
+{
+    // Game number and record of every buffered game; journal_first counts from the batch's first turn record
+    vector<pair<uint64_t, ArchiveRecord>> records;
+    vector<uint8_t> journal;
+};
+
+
+// Memory-mapped archive of finished games written by yahtzee_sim --archive. The file holds, in
+// order, the header, one 64-byte ArchiveRecord per game and the journal section of 16-byte turn
+// records in Journal's format. Values are in host byte order, like the policy file.
+class ReplayArchive
+{
+public:
+    static constexpr char MAGIC[4] = {'Y', 'A', 'R', 'C'};
+    static constexpr uint32_t VERSION = 1;
+
+/* *********************************************************************
+Function Name: ReplayArchive (Constructor)
+Purpose: To memory-map an archive and check its layout.
+Parameters:
+            path, a string passed by reference. It is the path of the archive.
+Return Value: None
+Algorithm:
+            1) Map the whole file read-only.
+            2) Throw if the magic or version differ, or the file size does not match the game and
+               turn record counts of the header (an archive whose writer did not finish has no header).
+Reference: none
+********************************************************************* */
+    explicit ReplayArchive(const string &path) : file(path, "replay archive")
+    {
+        ArchiveHeader header{};
+        if (file.size() >= sizeof(header))
+        {
+            memcpy(&header, file.data(), sizeof(header));
+        }
+        if (file.size() < sizeof(header) || memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+            header.version != VERSION || header.num_games > (file.size() - sizeof(header)) / sizeof(ArchiveRecord) ||
+            header.journal_offset != sizeof(header) + header.num_games * sizeof(ArchiveRecord) ||
+            (file.size() - header.journal_offset) / JOURNAL_RECORD_SIZE != header.num_journal_records ||
+            (file.size() - header.journal_offset) % JOURNAL_RECORD_SIZE != 0)
+        {
+            throw runtime_error("Invalid replay archive " + path);
+        }
+        num_games = header.num_games;
+        num_journal_records = header.num_journal_records;
+        records = reinterpret_cast<const ArchiveRecord *>(file.data() + sizeof(header));
+        journal = file.data() + header.journal_offset;
+    }
+
+    ReplayArchive(const ReplayArchive &) = delete;
+    ReplayArchive &operator=(const ReplayArchive &) = delete;
+
+
+    // The number of game records in the archive
+    uint64_t size() const
+    {
+        return num_games;
+    }
+
+
+    // The records of every game, in game order, for iterating over the mapped file
+    const ArchiveRecord *begin() const
+    {
+        return records;
+    }
+
+    const ArchiveRecord *end() const
+    {
+        return records + num_games;
+    }
+
+
+/* *********************************************************************
+Function Name: get_game
+Purpose: To jump to the record of one game.
+Parameters:
+            game, an unsigned integer. It is the game number.
+Return Value: The game's record, in place in the mapped file.
+Algorithm:
+            1) Throw if there is no such game, otherwise index the record array.
+Reference: none
+********************************************************************* */
+    const ArchiveRecord &get_game(const uint64_t game) const
+    {
+        if (game >= num_games)
+        {
+            throw out_of_range("The archive has no game " + to_string(game));
+        }
+        return records[game];
+    }
+
+
+/* *********************************************************************
+Function Name: get_turn_record
+Purpose: To decode one turn record of a game.
+Parameters:
+            record, an ArchiveRecord passed by reference. It is the game.
+            i, an unsigned integer below record.journal_count.
+            turn_record, a JournalRecord passed by reference. It receives the decoded record.
+Return Value: true if the record is intact, false if it is out of range or corrupt.
+Algorithm:
+            1) Check that the record lies inside the journal section and decode it.
+Reference: none
+********************************************************************* */
+    bool get_turn_record(const ArchiveRecord &record, const uint32_t i, JournalRecord &turn_record) const
+    {
+        if (i >= record.journal_count || record.journal_first + i >= num_journal_records)
+        {
+            return false;
+        }
+        return Journal::decode_record(journal + (record.journal_first + i) * JOURNAL_RECORD_SIZE, turn_record);
+    }
+
+
+/* *********************************************************************
+Function Name: get_score_card
+Purpose: To rebuild the full scorecard of a game.
+Parameters:
+            record, an ArchiveRecord passed by reference. It is the game.
+Return Value: The game's final ScoreCard.
+Algorithm:
+            1) Decode the record's binary save; it throws if the record is corrupt.
+Reference: none
+********************************************************************* */
+    static ScoreCard get_score_card(const ArchiveRecord &record)
+    {
+        int round = 1;
+        return BinarySave::decode(record.save, BINARY_SAVE_SIZE, round);
+    }
+
+
+/* *********************************************************************
+Function Name: add_game
+Purpose: To add a finished game to a simulation worker's batch.
+Parameters:
+            batch, an ArchiveBatch passed by reference. It receives the game.
+            game, an unsigned integer. It is the game number.
+            seed, an unsigned integer. It is the seed the game was played from.
+            result, a GameResult passed by reference. It is the finished game; its moves, if recorded,
+                become the game's turn records.
+Return Value: None
+Algorithm:
+            1) Fill a record with the seed, rounds, first player and the encoded final scorecard.
+            2) Encode every move as a turn record at the end of the batch's journal.
+            3) Append the record to the batch.
+Reference: none
+********************************************************************* */
+    static void add_game(ArchiveBatch &batch, const uint64_t game, const uint64_t seed, const GameResult &result)
+    {
+        ArchiveRecord record{};
+        record.seed = seed;
+        record.journal_first = batch.journal.size() / JOURNAL_RECORD_SIZE;
+        record.journal_count = static_cast<uint32_t>(result.moves.size());
+        record.rounds = static_cast<uint16_t>(result.rounds);
+        record.first_player = static_cast<uint8_t>(result.first_player);
+        record.flags = ARCHIVE_GAME_PRESENT;
+        BinarySave::encode(result.score_card, result.rounds, record.save);
+
+        static constexpr JournalEvent EVENTS[] = {JournalEvent::Roll, JournalEvent::Keep, JournalEvent::Stand,
+                                                  JournalEvent::Score};
+        size_t offset = batch.journal.size();
+        batch.journal.resize(offset + result.moves.size() * JOURNAL_RECORD_SIZE);
+        for (const Move &move : result.moves)
+        {
+            const int category = move.category.has_value() ? static_cast<int>(move.category.value()) : 0;
+            Journal::encode_record(JournalRecord{EVENTS[static_cast<int>(move.type)], move.player, move.round,
+                                                 move.roll_number, category, move.points, move.dice},
+                                   &batch.journal[offset]);
+            offset += JOURNAL_RECORD_SIZE;
+        }
+
+        batch.records.emplace_back(game, record);
+    }
+
+
+private:
+    MappedFile file;
+    uint64_t num_games = 0;
+    uint64_t num_journal_records = 0;
+    const ArchiveRecord *records = nullptr;
+    const uint8_t *journal = nullptr;
+};
+
+
+// Writes a replay archive for a known number of games. Workers hand in batches of games in any
+// order from any thread; the header is written last, so an archive that was not finished is rejected.
+class ReplayArchiveWriter
+{
+public:
+/* *********************************************************************
+Function Name: ReplayArchiveWriter (Constructor)
+Purpose: To create an archive with room for every game record.
+Parameters:
+            path, a string passed by reference. It is the path of the archive.
+            num_games, an unsigned integer. It is the number of games that will be written.
+Return Value: None
+Algorithm:
+            1) Create the file and extend it over the header and every game record, all zero.
+            2) Start the journal section right after the records.
+Reference: none
+********************************************************************* */
+    ReplayArchiveWriter(const string &path, const uint64_t num_games)
+        : path(path), num_games(num_games), journal_offset(sizeof(ArchiveHeader) + num_games * sizeof(ArchiveRecord))
+    {
+        file.open(path, ios::in | ios::out | ios::binary | ios::trunc);
+        file.seekp(static_cast<streamoff>(journal_offset) - 1);
+        file.put('\0');
+        if (!file)
+        {
+            throw runtime_error("Could not create replay archive " + path);
+        }
+    }
+
+    ReplayArchiveWriter(const ReplayArchiveWriter &) = delete;
+    ReplayArchiveWriter &operator=(const ReplayArchiveWriter &) = delete;
+
+
+/* *********************************************************************
+Function Name: write
+Purpose: To write a batch of games and empty the batch. Safe to call from several threads.
+Parameters:
+            batch, an ArchiveBatch passed by reference.
+Return Value: None
+Algorithm:
+            1) Append the batch's turn records to the journal section.
+            2) Shift the batch's journal indices to where its turn records landed.
+            3) Sort the records by game and write each run of consecutive games with one write.
+            4) Throw if a game number is out of range or the file cannot be written.
+Reference: none
+********************************************************************* */
+    void write(ArchiveBatch &batch)
+    {
+        const lock_guard<mutex> lock(write_mutex);
+
+        const uint64_t journal_base = num_journal_records;
+        file.seekp(static_cast<streamoff>(journal_offset + journal_base * JOURNAL_RECORD_SIZE));
+        file.write(reinterpret_cast<const char *>(batch.journal.data()), static_cast<streamsize>(batch.journal.size()));
+        num_journal_records += batch.journal.size() / JOURNAL_RECORD_SIZE;
+
+        sort(batch.records.begin(), batch.records.end(),
+             [](const pair<uint64_t, ArchiveRecord> &a, const pair<uint64_t, ArchiveRecord> &b)
+             { return a.first < b.first; });
+
+        vector<ArchiveRecord> run;
+        for (size_t i = 0; i < batch.records.size(); i++)
+        {
+            const uint64_t game = batch.records[i].first;
+            if (game >= num_games)
+            {
+                throw out_of_range("The archive has no game " + to_string(game));
+            }
+            run.push_back(batch.records[i].second);
+            run.back().journal_first += journal_base;
+
+            if (i + 1 == batch.records.size() || batch.records[i + 1].first != game + 1)
+            {
+                const uint64_t first_game = game + 1 - run.size();
+                file.seekp(static_cast<streamoff>(sizeof(ArchiveHeader) + first_game * sizeof(ArchiveRecord)));
+                file.write(reinterpret_cast<const char *>(run.data()),
+                           static_cast<streamsize>(run.size() * sizeof(ArchiveRecord)));
+                run.clear();
+            }
+        }
+
+        if (!file)
+        {
+            throw runtime_error("Could not write replay archive " + path);
+        }
+        batch.records.clear();
+        batch.journal.clear();
+    }
+
+
+/* *********************************************************************
+Function Name: finish
+Purpose: To complete the archive once every batch was written.
+Parameters: None
+Return Value: None
+Algorithm:
+            1) Write the header with the game and turn record counts and flush the file.
+Reference: none
+********************************************************************* */
+    void finish()
+    {
+        const lock_guard<mutex> lock(write_mutex);
+
+        ArchiveHeader header{};
+        memcpy(header.magic, ReplayArchive::MAGIC, sizeof(header.magic));
+        header.version = ReplayArchive::VERSION;
+        header.num_games = num_games;
+        header.journal_offset = journal_offset;
+        header.num_journal_records = num_journal_records;
+
+        file.seekp(0);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.flush();
+        if (!file)
+        {
+            throw runtime_error("Could not write replay archive " + path);
+        }
+    }
+
+
+private:
+    const string path;
+    const uint64_t num_games;
+    const uint64_t journal_offset;
+    uint64_t num_journal_records = 0;
+    fstream file;
+    mutex write_mutex;
+};
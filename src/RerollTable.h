@@ -0,0 +1,236 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "Hand.h"
+#include "ScoreTable.h"
+
+using namespace std;
+
+// Number of distinct hands of 0 to 5 dice, the size of ALL_HANDS
+constexpr int NUM_ALL_HANDS = NUM_DICE_COMBINATIONS;
+
+// Number of (kept hand, final hand) pairs when the dice that are not kept are rolled to make five:
+// the sum over kept sizes s of C(s + 5, 5) * C(10 - s, 5)
+constexpr int NUM_REROLL_OUTCOMES = 4368;
+
+// Struct to hold one possible result of rolling the dice that are not kept
+struct RerollOutcome
+{
+    // The five dice after the roll, kept and rolled together
+    Hand final_hand;
+
+    // Number of ordered rolls of the rerolled dice that give this hand; its probability is
+    // weight / 6^(rerolled dice)
+    uint16_t weight;
+
+    // Row of the final hand in HAND_SCORES
+    uint8_t final_id;
+};
+
+// A read-only view of every outcome of one reroll, in hand_combinations order of the rolled dice
+class RerollOutcomes
+{
+public:
+    constexpr RerollOutcomes(const RerollOutcome *first, const RerollOutcome *last, const int total_weight)
+        : first(first), last(last), total_weight(total_weight)
+    {
+    }
+
+    constexpr const RerollOutcome *begin() const
+    {
+        return first;
+    }
+
+    constexpr const RerollOutcome *end() const
+    {
+        return last;
+    }
+
+    constexpr int size() const
+    {
+        return static_cast<int>(last - first);
+    }
+
+    // Number of ordered rolls of the rerolled dice, 6^(rerolled dice); the weights add up to it
+    constexpr int get_total_weight() const
+    {
+        return total_weight;
+    }
+
+    // Exact probability of an outcome of this reroll
+    constexpr double get_probability(const RerollOutcome &outcome) const
+    {
+        return static_cast<double>(outcome.weight) / total_weight;
+    }
+
+private:
+    const RerollOutcome *first;
+    const RerollOutcome *last;
+    int total_weight;
+};
+
+// The outcomes of rerolling from every hand of 0 to 5 dice
+struct RerollTable
+{
+    // The outcomes of kept hand i (ALL_HANDS[i]) are outcomes[first_outcome[i]] to outcomes[first_outcome[i + 1] - 1]
+    array<uint16_t, NUM_ALL_HANDS + 1> first_outcome;
+    array<RerollOutcome, NUM_REROLL_OUTCOMES> outcomes;
+};
+
+
+/* *********************************************************************
+Function Name: hand_index
+Purpose: To get the index of a hand of 0 to 5 dice among every such hand.
+Parameters:
+            hand, a Hand passed by reference.
+Return Value: The hand's position in ALL_HANDS, from 0 to 461; it is the same index TurnSolver::index
+              gives.
+Algorithm:
+            1) Skip the hands of every smaller size.
+            2) Walk the dice in ascending order; for each die, count the sorted hands that agree so far
+               but show a lower face here. With m dice left after this one and a lower face v, those
+               are the multisets of m dice from faces v to 6, C(6 - v + m, m).
+Reference: none
+********************************************************************* */
+constexpr int hand_index(const Hand &hand)
+{
+    const int size = hand.size();
+    int index = 0;
+    for (int s = 0; s < size; s++)
+    {
+        index += binomial(s + 5, 5);
+    }
+
+    int previous = 1;
+    int remaining = size;
+    for (int face = 1; face <= 6; face++)
+    {
+        for (int c = 0; c < hand.count(face); c++)
+        {
+            remaining--;
+            for (int lower = previous; lower < face; lower++)
+            {
+                index += binomial(6 - lower + remaining, remaining);
+            }
+            previous = face;
+        }
+    }
+    return index;
+}
+
+
+/* *********************************************************************
+Function Name: count_orderings
+Purpose: To count the ordered rolls that give a hand.
+Parameters:
+            hand, a Hand passed by reference.
+Return Value: The multinomial coefficient n! / (product of count! over the faces).
+Algorithm:
+            1) Divide the factorial of the hand size by the factorial of every face count.
+Reference: none
+********************************************************************* */
+constexpr int count_orderings(const Hand &hand)
+{
+    const int factorials[6] = {1, 1, 2, 6, 24, 120};
+    int orderings = factorials[hand.size()];
+    for (int face = 1; face <= 6; face++)
+    {
+        orderings /= factorials[hand.count(face)];
+    }
+    return orderings;
+}
+
+
+/* *********************************************************************
+Function Name: build_reroll_table
+Purpose: To build the reroll outcome table at compile time.
+Parameters: None
+Return Value: The filled RerollTable.
+Algorithm:
+            1) For every kept hand of ALL_HANDS, pair it with every hand of the remaining dice, giving
+               the final hand, its HAND_SCORES row and the number of orderings of the rolled dice.
+Reference: none
+********************************************************************* */
+constexpr RerollTable build_reroll_table()
+{
+    RerollTable table{};
+
+    int outcome = 0;
+    for (int k = 0; k < NUM_ALL_HANDS; k++)
+    {
+        table.first_outcome[k] = static_cast<uint16_t>(outcome);
+        const Hand &kept_dice = ALL_HANDS[k];
+        for (const Hand &rolled_dice : hand_combinations(5 - kept_dice.size()))
+        {
+            const Hand final_hand = kept_dice + rolled_dice;
+            table.outcomes[outcome++] = RerollOutcome{final_hand, static_cast<uint16_t>(count_orderings(rolled_dice)),
+                                                      static_cast<uint8_t>(final_hand.id())};
+        }
+    }
+    table.first_outcome[NUM_ALL_HANDS] = static_cast<uint16_t>(outcome);
+    return table;
+}
+
+
+/* *********************************************************************
+Function Name: indexes_all_hands
+Purpose: To check at compile time that hand_index agrees with the order of ALL_HANDS.
+Parameters: None
+Return Value: true if hand_index(ALL_HANDS[i]) is i for every hand.
+Algorithm:
+            1) Compare the index of every hand with its position.
+Reference: none
+********************************************************************* */
+constexpr bool indexes_all_hands()
+{
+    for (int i = 0; i < NUM_ALL_HANDS; i++)
+    {
+        if (hand_index(ALL_HANDS[i]) != i)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(indexes_all_hands(), "hand_index follows the order of ALL_HANDS");
+
+
+// The outcomes of every reroll, computed by the compiler
+inline constexpr RerollTable REROLL_TABLE = build_reroll_table();
+
+static_assert(REROLL_TABLE.first_outcome[NUM_ALL_HANDS] == NUM_REROLL_OUTCOMES, "every reroll outcome is listed");
+
+
+/* *********************************************************************
+Function Name: get_reroll_outcomes
+Purpose: To get every outcome of rolling the dice that are not kept, with its exact probability.
+Parameters:
+            kept_dice, a Hand of 0 to 5 dice passed by reference.
+Return Value: A view of the outcomes in REROLL_TABLE; keeping all five dice has the single outcome
+              of the kept hand itself.
+Algorithm:
+            1) Find the kept hand's range of outcomes and the number of ordered rolls of the other dice.
+Reference: none
+********************************************************************* */
+constexpr RerollOutcomes get_reroll_outcomes(const Hand &kept_dice)
+{
+    const int k = hand_index(kept_dice);
+    int total_weight = 1;
+    for (int i = kept_dice.size(); i < 5; i++)
+    {
+        total_weight *= 6;
+    }
+    return RerollOutcomes(REROLL_TABLE.outcomes.data() + REROLL_TABLE.first_outcome[k],
+                          REROLL_TABLE.outcomes.data() + REROLL_TABLE.first_outcome[k + 1], total_weight);
+}
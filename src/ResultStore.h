@@ -0,0 +1,420 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "GameEngine.h"
+#include "ScoreCategory.h"
+
+using namespace std;
+
+// Highest score one player can reach: the maximum of every category added up
+constexpr int MAX_SCORE = 310;
+
+// Games longer than this many rounds are counted in the last bucket of the round histogram
+constexpr int MAX_ROUNDS = 64;
+
+// Number of games in one chunk of the result store
+constexpr size_t RESULT_CHUNK_GAMES = 4096;
+
+// Struct to hold the count, mean and variance of a column
+struct ColumnMoments
+{
+    uint64_t count;
+    double mean;
+    double variance;
+};
+
+// A chunk of finished games stored column by column: every column is a contiguous array with one
+// entry per game, so a reduction over a column reads only that column's bytes. A simulation worker
+// fills a chunk of its own and hands it to the ResultStore once it is full.
+struct ResultChunk
+{
+    size_t size = 0;
+
+    // Seed each game was played from
+    array<uint64_t, RESULT_CHUNK_GAMES> seed;
+
+    // Index of the winning player, -1 for a draw
+    array<int8_t, RESULT_CHUNK_GAMES> winner;
+
+    // Index of the player who took the first turn
+    array<uint8_t, RESULT_CHUNK_GAMES> first_player;
+
+    array<uint16_t, RESULT_CHUNK_GAMES> rounds;
+
+    // score[p][g] is player p's final score in game g
+    array<array<uint16_t, RESULT_CHUNK_GAMES>, 2> score;
+
+    // Per category: the points, the round it was filled in (0 if open) and the index of the player
+    // who filled it (-1 if open)
+    array<array<uint8_t, RESULT_CHUNK_GAMES>, NUM_CATEGORIES> points;
+    array<array<uint8_t, RESULT_CHUNK_GAMES>, NUM_CATEGORIES> fill_round;
+    array<array<int8_t, RESULT_CHUNK_GAMES>, NUM_CATEGORIES> fill_player;
+
+    bool is_full() const
+    {
+        return size == RESULT_CHUNK_GAMES;
+    }
+
+
+/* *********************************************************************
+Function Name: add
+Purpose: To append one finished game to every column.
+Parameters:
+            game_seed, an unsigned integer. It is the seed the game was played from.
+            result, a GameResult passed by reference. It is the finished game.
+Return Value: None
+Algorithm:
+            1) Store the seed, the first player, the rounds and both final scores; derive the winner.
+            2) For every category, store its points, fill round and filling player.
+Reference: none
+********************************************************************* */
+    void add(const uint64_t game_seed, const GameResult &result)
+    {
+        const size_t g = size++;
+        seed[g] = game_seed;
+        first_player[g] = static_cast<uint8_t>(result.first_player);
+        rounds[g] = static_cast<uint16_t>(result.rounds);
+
+        const int first_score = result.score_card.get_player_score(0);
+        const int second_score = result.score_card.get_player_score(1);
+        score[0][g] = static_cast<uint16_t>(first_score);
+        score[1][g] = static_cast<uint16_t>(second_score);
+        winner[g] = first_score == second_score ? -1 : (first_score > second_score ? 0 : 1);
+
+        for (int c = 0; c < NUM_CATEGORIES; c++)
+        {
+            const optional<ScoreCardEntry> entry = result.score_card.get_entry(static_cast<Category>(c + 1));
+            points[c][g] = entry.has_value() ? static_cast<uint8_t>(entry.value().points) : 0;
+            fill_round[c][g] = entry.has_value() ? static_cast<uint8_t>(min(entry.value().round, 255)) : 0;
+            fill_player[c][g] = entry.has_value() ? entry.value().player : -1;
+        }
+    }
+};
+
+
+// Column-oriented store of simulation results. Workers append whole chunks, and every statistic is
+// a reduction that runs over one or two columns of each chunk with a simple loop the compiler
+// vectorizes, so scanning many games is bound by memory bandwidth.
+class ResultStore
+{
+public:
+/* *********************************************************************
+Function Name: append
+Purpose: To add a chunk of games to the store. Safe to call from several threads.
+Parameters:
+            chunk, a unique_ptr to the chunk; empty chunks are dropped.
+Return Value: None
+Algorithm:
+            1) Take ownership of the chunk under the store's lock.
+Reference: none
+********************************************************************* */
+    void append(unique_ptr<ResultChunk> chunk)
+    {
+        if (chunk == nullptr || chunk->size == 0)
+        {
+            return;
+        }
+        const lock_guard<mutex> lock(append_mutex);
+        num_games += chunk->size;
+        chunks.push_back(move(chunk));
+    }
+
+
+    // The number of games in the store
+    uint64_t size() const
+    {
+        return num_games;
+    }
+
+
+/* *********************************************************************
+Function Name: count_wins
+Purpose: To count the games a player won.
+Parameters:
+            player, an integer. It is the index of the player, or -1 to count draws.
+Return Value: The number of games.
+Algorithm:
+            1) Count the matching entries of the winner column.
+Reference: none
+********************************************************************* */
+    uint64_t count_wins(const int player) const
+    {
+        uint64_t count = 0;
+        for (const unique_ptr<ResultChunk> &chunk : chunks)
+        {
+            uint32_t chunk_count = 0;
+            for (size_t g = 0; g < chunk->size; g++)
+            {
+                chunk_count += chunk->winner[g] == player;
+            }
+            count += chunk_count;
+        }
+        return count;
+    }
+
+
+/* *********************************************************************
+Function Name: count_first_player_wins
+Purpose: To count the games won by the player who took the first turn.
+Parameters: None
+Return Value: The number of games.
+Algorithm:
+            1) Count the games whose winner column equals their first-player column.
+Reference: none
+********************************************************************* */
+    uint64_t count_first_player_wins() const
+    {
+        uint64_t count = 0;
+        for (const unique_ptr<ResultChunk> &chunk : chunks)
+        {
+            uint32_t chunk_count = 0;
+            for (size_t g = 0; g < chunk->size; g++)
+            {
+                chunk_count += chunk->winner[g] == static_cast<int8_t>(chunk->first_player[g]);
+            }
+            count += chunk_count;
+        }
+        return count;
+    }
+
+
+/* *********************************************************************
+Function Name: count_fills
+Purpose: To count the games in which a player filled a category.
+Parameters:
+            category, a Category.
+            player, an integer. It is the index of the player.
+Return Value: The number of games.
+Algorithm:
+            1) Count the matching entries of the category's fill-player column.
+Reference: none
+********************************************************************* */
+    uint64_t count_fills(const Category category, const int player) const
+    {
+        const int c = static_cast<int>(category) - 1;
+        uint64_t count = 0;
+        for (const unique_ptr<ResultChunk> &chunk : chunks)
+        {
+            uint32_t chunk_count = 0;
+            for (size_t g = 0; g < chunk->size; g++)
+            {
+                chunk_count += chunk->fill_player[c][g] == player;
+            }
+            count += chunk_count;
+        }
+        return count;
+    }
+
+
+/* *********************************************************************
+Function Name: get_points_moments
+Purpose: To get the mean and variance of a category's points over the games it was filled in.
+Parameters:
+            category, a Category.
+Return Value: The ColumnMoments of the points.
+Algorithm:
+            1) Reduce the points column, counting only games whose fill round is not 0.
+Reference: none
+********************************************************************* */
+    ColumnMoments get_points_moments(const Category category) const
+    {
+        const int c = static_cast<int>(category) - 1;
+        return get_filled_moments(c, [c](const ResultChunk &chunk)
+                                  { return chunk.points[c].data(); });
+    }
+
+
+/* *********************************************************************
+Function Name: get_fill_round_moments
+Purpose: To get the mean and variance of the round a category was filled in.
+Parameters:
+            category, a Category.
+Return Value: The ColumnMoments of the fill round.
+Algorithm:
+            1) Reduce the fill-round column, counting only games whose fill round is not 0.
+Reference: none
+********************************************************************* */
+    ColumnMoments get_fill_round_moments(const Category category) const
+    {
+        const int c = static_cast<int>(category) - 1;
+        return get_filled_moments(c, [c](const ResultChunk &chunk)
+                                  { return chunk.fill_round[c].data(); });
+    }
+
+
+/* *********************************************************************
+Function Name: get_round_moments
+Purpose: To get the mean and variance of the number of rounds per game.
+Parameters: None
+Return Value: The ColumnMoments of the rounds column.
+Algorithm:
+            1) Add up the count, sum and sum of squares of every entry of the rounds column.
+            2) Derive the mean and the population variance from the totals.
+Reference: none
+********************************************************************* */
+    ColumnMoments get_round_moments() const
+    {
+        uint64_t sum = 0;
+        uint64_t sum_squares = 0;
+        for (const unique_ptr<ResultChunk> &chunk : chunks)
+        {
+            for (size_t g = 0; g < chunk->size; g++)
+            {
+                const uint64_t rounds = chunk->rounds[g];
+                sum += rounds;
+                sum_squares += rounds * rounds;
+            }
+        }
+
+        if (num_games == 0)
+        {
+            return ColumnMoments{0, 0, 0};
+        }
+        const double mean = static_cast<double>(sum) / num_games;
+        return ColumnMoments{num_games, mean, max(0.0, static_cast<double>(sum_squares) / num_games - mean * mean)};
+    }
+
+
+/* *********************************************************************
+Function Name: get_score_histogram
+Purpose: To get the distribution of a player's final scores.
+Parameters:
+            player, an integer. It is the index of the player.
+Return Value: An array whose entry s is the number of games the player finished with s points.
+Algorithm:
+            1) Count every entry of the player's score column in its bucket.
+Reference: none
+********************************************************************* */
+    array<uint64_t, MAX_SCORE + 1> get_score_histogram(const int player) const
+    {
+        array<uint64_t, MAX_SCORE + 1> counts{};
+        for (const unique_ptr<ResultChunk> &chunk : chunks)
+        {
+            for (size_t g = 0; g < chunk->size; g++)
+            {
+                counts[min<int>(chunk->score[player][g], MAX_SCORE)]++;
+            }
+        }
+        return counts;
+    }
+
+
+/* *********************************************************************
+Function Name: get_round_histogram
+Purpose: To get the distribution of the number of rounds per game.
+Parameters: None
+Return Value: An array whose entry r is the number of games that took r rounds; longer games are in the last entry,
+              so it gives percentiles but not the mean (see get_round_moments).
+Algorithm:
+            1) Count every entry of the rounds column in its bucket.
+Reference: none
+********************************************************************* */
+    array<uint64_t, MAX_ROUNDS + 1> get_round_histogram() const
+    {
+        array<uint64_t, MAX_ROUNDS + 1> counts{};
+        for (const unique_ptr<ResultChunk> &chunk : chunks)
+        {
+            for (size_t g = 0; g < chunk->size; g++)
+            {
+                counts[min<int>(chunk->rounds[g], MAX_ROUNDS)]++;
+            }
+        }
+        return counts;
+    }
+
+
+/* *********************************************************************
+Function Name: get_best_game
+Purpose: To find the game with the highest single score.
+Parameters: None
+Return Value: The highest score and the seed of the first game it was reached in, {0, 0} if the store is empty.
+Algorithm:
+            1) Scan both score columns, remembering the highest score and its game's seed.
+Reference: none
+********************************************************************* */
+    pair<int, uint64_t> get_best_game() const
+    {
+        pair<int, uint64_t> best = {0, 0};
+        for (const unique_ptr<ResultChunk> &chunk : chunks)
+        {
+            for (size_t g = 0; g < chunk->size; g++)
+            {
+                const int score = max(chunk->score[0][g], chunk->score[1][g]);
+                if (score > best.first)
+                {
+                    best = {score, chunk->seed[g]};
+                }
+            }
+        }
+        return best;
+    }
+
+
+private:
+    vector<unique_ptr<ResultChunk>> chunks;
+    uint64_t num_games = 0;
+    mutex append_mutex;
+
+/* *********************************************************************
+Function Name: get_filled_moments
+Purpose: To get the mean and variance of a per-category column over the games the category was filled in.
+Parameters:
+            c, an integer. It is the category's position, 0 to 11.
+            column, a function returning the column's array in a chunk.
+Return Value: The ColumnMoments of the column.
+Algorithm:
+            1) For every chunk, add up the count, sum and sum of squares of the entries whose fill round
+               is not 0, without branching so the loop vectorizes; a chunk's sums fit in 32 bits.
+            2) Derive the mean and the population variance from the totals.
+Reference: none
+********************************************************************* */
+    template <typename Column>
+    ColumnMoments get_filled_moments(const int c, Column column) const
+    {
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t sum_squares = 0;
+        for (const unique_ptr<ResultChunk> &chunk : chunks)
+        {
+            const uint8_t *values = column(*chunk);
+            const uint8_t *rounds = chunk->fill_round[c].data();
+            uint32_t chunk_count = 0;
+            uint32_t chunk_sum = 0;
+            uint32_t chunk_squares = 0;
+            for (size_t g = 0; g < chunk->size; g++)
+            {
+                const uint32_t filled = rounds[g] != 0;
+                const uint32_t value = values[g] * filled;
+                chunk_count += filled;
+                chunk_sum += value;
+                chunk_squares += value * value;
+            }
+            count += chunk_count;
+            sum += chunk_sum;
+            sum_squares += chunk_squares;
+        }
+
+        if (count == 0)
+        {
+            return ColumnMoments{0, 0, 0};
+        }
+        const double mean = static_cast<double>(sum) / count;
+        return ColumnMoments{count, mean, max(0.0, static_cast<double>(sum_squares) / count - mean * mean)};
+    }
+};
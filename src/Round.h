@@ -9,10 +9,13 @@
 #pragma once
 
 #include "ScoreCard.h"
+#include <algorithm>
 #include <queue>
 #include <memory>
 
 #include "Dice.h"
+#include "Journal.h"
+#include "Trace.h"
 #include "Turn.h"
 
 class Round
@@ -29,30 +32,36 @@ Parameters:
             containing the scores of all players.
         const vector<shared_ptr<Player> > &players: A vector of shared pointers
             to Player objects participating in the round.
+        const vector<int> &finished_players: Indices of the players who already
+            took their turn in this round, when a journaled game is recovered
+            in the middle of it. They are skipped.
 Return Value: The updated ScoreCard after the round has concluded.
 Algorithm:
-        1. Retrieve player scores from the scorecard.
-        2. Create a player queue based on scores to determine turn order.
-        3. Copy the current scorecard to track changes during the round.
-        4. Loop until the round is over (when all players have played or
+        1. Create a player queue based on the players' scores to determine turn order,
+            or of the players yet to play when some already finished this round.
+        2. Copy the current scorecard to track changes during the round.
+        3. Loop until the round is over (when all players have played or
             the scorecard is full):
             a. Get the next player from the queue.
             b. Output the current state of the scorecard.
             c. Announce the player's turn.
             d. Simulate the player's turn by rolling the dice.
-            e. Determine the highest scoring category based on the rolled dice.
-            f. If a valid category is found, display the score achieved.
-            g. Update the scorecard with the new scores.
+            e. Choose the category the current scorecard fills with the rolled dice.
+            f. If a valid category is found, display the score achieved and fill it.
+            g. Journal the filled category and its points when the game is journaled.
             h. Re-check if the round is over.
-        5. Announce the end of the round.
+        4. Journal and announce the end of the round.
 *****************************************************************
 */
     static ScoreCard play_round(const int round_number, const ScoreCard &score_card,
-                                const vector<shared_ptr<Player>> &players)
+                                const vector<shared_ptr<Player>> &players,
+                                const vector<int> &finished_players = {})
     {
-        // Get the player scores and create a queue of players which determines the order of players
-        auto player_scores = score_card.get_player_scores(players);
-        auto player_queue = get_player_queue(player_scores);
+        TRACE_SPAN("Round::play_round");
+        // Create a queue of players from their scores, which determines the order of players
+        auto player_queue = finished_players.empty() ? get_player_queue(score_card, players)
+                                                     : get_remaining_player_queue(players, finished_players);
+        Journal *journal = Journal::active();
 
         // Copy the current scorecard
         ScoreCard current_score_card = score_card;
@@ -64,34 +73,49 @@ Algorithm:
             // Get the next player from the queue and remove them from the front
             auto player = player_queue.front();
             player_queue.pop();
+            const int player_index = player == players[0] ? 0 : 1;
 
             // Output the current state of the scorecard to the console
-            cout << current_score_card.get_string() << endl;
+            cout << current_score_card.get_string(players) << endl;
 
             // Announce the player's turn
             cout << "It's " << player->get_name() << "'s turn." << endl;
+            if (journal != nullptr)
+            {
+                journal->begin_turn(round_number, player_index);
+            }
 
             // Simulate the player's turn by rolling the dice
-            vector<int> dice = Turn::play_turn(player, score_card);
+            Hand dice = Turn::play_turn(player, score_card);
 
-            // Determine the highest scoring category based on the rolled dice
-            auto scored_category = score_card.get_max_scoring_category(dice);
+            // Choose the category the current scorecard fills with the rolled dice, once, so the
+            // announced, filled and journaled categories are the same
+            const optional<Category> scored_category = current_score_card.get_scoring_category(dice);
+            const int points = scored_category.has_value() ? get_score(dice, scored_category.value()) : 0;
 
-            // If a valid scoring category is found, display the score
+            // If a valid scoring category is found, display the score and update the scorecard
             if (scored_category.has_value())
             {
-                cout << player->get_name() << " scored " << get_score(dice, scored_category.value()) << " points in the "
+                cout << player->get_name() << " scored " << points << " points in the "
                      << CATEGORY_NAMES[scored_category.value()] << " category.\n\n"
                      << endl;
+                current_score_card =
+                    current_score_card.add_entry(scored_category.value(), points, player_index, round_number);
+            }
+            if (journal != nullptr)
+            {
+                journal->record_score(scored_category, points, dice);
             }
-            // Update the scorecard with the new scores for this player and round
-            current_score_card = current_score_card.add_entry(round_number, player, dice);
 
             // Check again if the round is over (queue is empty or scorecard is full)
             round_over = player_queue.empty() || current_score_card.is_full();
         }
 
         // Announce the end of the round
+        if (journal != nullptr)
+        {
+            journal->record_round_end(round_number);
+        }
         cout << "Round ends" << endl;
 
         // Return the updated scorecard after the round
@@ -106,29 +130,28 @@ Function Name: get_player_queue
 Purpose: To create a queue of players ordered by their scores,
         determining who plays first based on the lowest score.
 Parameters:
-    const map<shared_ptr<Player>, int> &player_scores: A map of
-            players and their corresponding scores.
+    const ScoreCard &score_card: The scorecard holding the running
+            totals of the players.
+    const vector<shared_ptr<Player> > &players: The two players.
 Return Value: A queue of shared pointers to Player objects
                 in the order they will take their turns.
 Algorithm:
-        1. Extract the top two players from the player_scores map.
-        2. Compare their scores.
-        3. If scores are tied, conduct a tie-breaker to determine the
+        1. Read both players' running totals from the scorecard.
+        2. If scores are tied, conduct a tie-breaker to determine the
             turn order.
-        4. If scores differ, enqueue players based on their scores
-            (lowest score goes first).
+        3. If scores differ, enqueue the player with the lower score
+            first.
 *****************************************************************
   */
-    static queue<shared_ptr<Player>> get_player_queue(const map<shared_ptr<Player>, int> &player_scores)
+    static queue<shared_ptr<Player>> get_player_queue(const ScoreCard &score_card,
+                                                      const vector<shared_ptr<Player>> &players)
     {
-        queue<Player> player_queue;
-
         // Extract the players and their scores (for comparison)
-        const auto player_1 = player_scores.begin()->first;
-        const auto player_2 = player_scores.rbegin()->first;
+        const auto &player_1 = players[0];
+        const auto &player_2 = players[1];
 
-        const int player_1_score = player_scores.begin()->second;
-        const int player_2_score = player_scores.rbegin()->second;
+        const int player_1_score = score_card.get_player_score(0);
+        const int player_2_score = score_card.get_player_score(1);
 
         // If both players have the same score, conduct a tie-breaker to determine the turn order
         if (player_1_score == player_2_score)
@@ -145,8 +168,40 @@ Algorithm:
             return queue_from_tie_breaker(player_1, player_2);
         }
 
-        // If the scores differ, enqueue players based on their scores (lowest score goes first)
-        return enqueue_players_by_score(player_scores);
+        // If the scores differ, the player with the lower score goes first
+        queue<shared_ptr<Player>> player_queue;
+        player_queue.push(player_1_score < player_2_score ? player_1 : player_2);
+        player_queue.push(player_1_score < player_2_score ? player_2 : player_1);
+        return player_queue;
+    }
+
+
+/*
+*****************************************************************
+Function Name: get_remaining_player_queue
+Purpose: To create a queue of the players who have not yet taken
+        their turn in a round that was interrupted.
+Parameters:
+    const vector<shared_ptr<Player> > &players: The two players.
+    const vector<int> &finished_players: Indices of the players who
+            already took their turn.
+Return Value: A queue of shared pointers to the remaining players.
+Algorithm:
+        1. Enqueue, in order, every player whose index is not finished.
+*****************************************************************
+*/
+    static queue<shared_ptr<Player>> get_remaining_player_queue(const vector<shared_ptr<Player>> &players,
+                                                                const vector<int> &finished_players)
+    {
+        queue<shared_ptr<Player>> player_queue;
+        for (int i = 0; i < static_cast<int>(players.size()); i++)
+        {
+            if (find(finished_players.begin(), finished_players.end(), i) == finished_players.end())
+            {
+                player_queue.push(players[i]);
+            }
+        }
+        return player_queue;
     }
 
 
@@ -194,44 +249,4 @@ Algorithm:
         // Return the player queue after the tie-breaker
         return player_queue;
     }
-
-
-/*
-*****************************************************************
-Function Name: enqueue_players_by_score
-Purpose: To create a queue of players sorted by their scores in
-        ascending order.
-Parameters:
-            const map<shared_ptr<Player>, int> &player_scores: A map of
-            players and their corresponding scores.
-Return Value: A queue of shared pointers to Player objects,ordered by their scores.
-Algorithm:
-        1. Convert the player_scores map to a vector of player-score pairs.
-        2. Sort the vector by scores in ascending order.
-        3. Create a queue and enqueue players in order of their scores.
-*****************************************************************
-   */
-    static queue<shared_ptr<Player>>
-    enqueue_players_by_score(const map<shared_ptr<Player>, int> &player_scores)
-    {
-        // Convert the player scores map to a vector of player-score pairs
-        vector<pair<shared_ptr<Player>, int>> player_score_vector(player_scores.begin(), player_scores.end());
-
-        // Sort the players by their scores in ascending order
-        sort(player_score_vector.begin(), player_score_vector.end(),
-             [](const pair<shared_ptr<Player>, int> &a, const pair<shared_ptr<Player>, int> &b)
-             {
-                 return a.second < b.second;
-             });
-
-        // Create a queue and enqueue players in order of their scores (lowest to highest)
-        queue<shared_ptr<Player>> player_queue;
-        for (const auto &[player, score] : player_score_vector)
-        {
-            player_queue.push(player);
-        }
-
-        // Return the ordered queue of players
-        return player_queue;
-    }
 };
@@ -9,39 +9,64 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <iomanip>
 #include <optional>
 #include <map>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
 
 #include "ScoreCategory.h"
 #include "Player.h"
+#include "Trace.h"
+#include "ValueTable.h"
 
 using namespace std;
 
-// Forward declarations
-struct ScoreCardEntry;
-enum class Category;
-
 // Struct to hold the points, winner, and round of a scorecard entry
 struct ScoreCardEntry
 {
     int points;
-    shared_ptr<Player> winner;
+
+    // Index of the winner in the game's player list
+    int player;
     int round;
 
     // Equality operator to compare two ScoreCardEntry objects
     bool operator==(const ScoreCardEntry &other) const
     {
-        return points == other.points && winner == other.winner && round == other.round;
+        return points == other.points && player == other.player && round == other.round;
     }
 };
 
+// Struct to hold one category of the flat scorecard
+struct ScoreSlot
+{
+    uint8_t points;
+
+    // Index of the winner in the game's player list, or NO_PLAYER while the category is open
+    int8_t player;
+    uint16_t round;
+};
+
+// Player index of an open category
+constexpr int8_t NO_PLAYER = -1;
+
+// Number of players a scorecard is shared between
+constexpr int NUM_PLAYERS = 2;
+
+// The shared scorecard. Categories live in a 12-slot array indexed by category value - 1, the filled
+// categories are a bitmask, and each player's total, fill count and the current leader are kept up to
+// date by add_entry, so copying a scorecard copies a few dozen bytes and the common queries are O(1).
+// Players are plain indices into the player list of the Game or GameEngine that owns the scorecard;
+// only the functions that print names take that list.
 class ScoreCard
 {
 public:
-    // Default constructor that initializes the scorecard with nullopt values for all categories
-    ScoreCard() : score_card(initialize_score_card())
+    // Default constructor that initializes the scorecard with every category open
+    ScoreCard() : slots(initialize_slots()), filled_mask(0), totals{0, 0}, fill_counts{0, 0}, leader(NO_PLAYER)
     {
     }
 
@@ -51,8 +76,8 @@ Function Name: deserialize
 Purpose: To construct a ScoreCard from a serialized string representation.
 Parameters:
         serial, a string that contains serialized scorecard data.
-        human, a shared_ptr to the human player. It tracks the human's score.
-        computer, a shared_ptr to the computer player. It tracks the computer's score.
+        players, the two players of the game. An entry goes to the first player if it carries
+            their name and to the second player otherwise.
 Return Value: A ScoreCard object populated with the deserialized data.
 Algorithm:
         1) Split the serialized string into lines.
@@ -64,14 +89,13 @@ Algorithm:
 Reference: none
 Optional: cppreference.com
 ********************************************************************* */
-    static ScoreCard deserialize(const string &serial, const shared_ptr<Player> &human,
-                                 const shared_ptr<Player> &computer)
+    static ScoreCard deserialize(const string &serial, const vector<shared_ptr<Player>> &players)
     {
         const vector<string> lines = split(serial, '\n');
 
         // Track which category we are processing
         int category_index = 0;
-        map<Category, optional<ScoreCardEntry>> score_card;
+        ScoreCard score_card;
 
         // loop through each line,remove leading/trailing whitespaces, skip empty lines
         for (auto line : lines)
@@ -85,7 +109,6 @@ Optional: cppreference.com
             // If line is "0", it indicates the category is unfilled
             if (line == "0")
             {
-                score_card[CATEGORIES[category_index]] = nullopt;
                 category_index++;
                 continue;
             }
@@ -104,23 +127,24 @@ Optional: cppreference.com
 
             // Parse the points, winner, and round
             const int points = stoi(parts[0]);
-            const auto winner = parts[1] == "Human" ? human : computer;
+            const int winner = parts[1] == players[0]->get_name() ? 0 : 1;
             const int round = stoi(parts[2]);
 
-            // Create a ScoreCardEntry and store it in the scorecard
-            score_card[category].emplace(ScoreCardEntry{points, winner, round});
+            // Store the entry in the scorecard
+            score_card = score_card.add_entry(category, points, winner, round);
             category_index++;
         }
 
         // returns the scorecard with categories mapped to their details(winner, points, round)
-        return ScoreCard(score_card);
+        return score_card;
     }
 
 
 /* *********************************************************************
 Function Name: serialize
 Purpose: To convert the scorecard to a string representation.
-Parameters: None
+Parameters:
+        players, the players the entries' indices refer to.
 Return Value: A string representing the serialized scorecard.
 Algorithm:
         1) Create a stringstream to build the serialized string.
@@ -130,17 +154,17 @@ Algorithm:
         5) Return the string representation of the scorecard.
 Reference: none
 ********************************************************************* */
-    string serialize() const
+    string serialize(const vector<shared_ptr<Player>> &players) const
     {
         stringstream serial;
-        for (auto const &entry : score_card)
+        for (const Category category : CATEGORIES)
         {
-            if (entry.second.has_value())
+            const ScoreSlot &slot = get_slot(category);
+            if (slot.player != NO_PLAYER)
             {
                 // If the entry has a value, serialize points, winner's name, and round
-                ScoreCardEntry score_card_entry = entry.second.value();
-                serial << to_string(score_card_entry.points) << " " << score_card_entry.winner->get_name() << " "
-                       << to_string(score_card_entry.round) << "\n";
+                serial << to_string(slot.points) << " " << players[slot.player]->get_name() << " "
+                       << to_string(slot.round) << "\n";
             }
             else
             {
@@ -151,35 +175,6 @@ Reference: none
         return serial.str();
     }
 
-    // Copy constructor
-    ScoreCard(const ScoreCard &other) : score_card(other.score_card)
-    {
-    }
-
-
-/* *********************************************************************
-Function Name: operator=
-Purpose: To assign one ScoreCard object to another.
-Parameters:
-            other, a reference to another ScoreCard object to be copied.
-Return Value: A reference to the updated ScoreCard object.
-Algorithm:
-            1) Check for self-assignment.
-            2) Destroy the current object to free resources.
-            3) Use placement new to create a new ScoreCard object from 'other'.
-            4) Return a reference to this object.
-Reference: none
-********************************************************************* */
-    ScoreCard &operator=(const ScoreCard &other)
-    {
-        if (this != &other)
-        {
-            this->~ScoreCard();          // Destroy the current object
-            new (this) ScoreCard(other); // Placement new to reinitialize the object
-        }
-        return *this;
-    }
-
 
 /* *********************************************************************
 Function Name: operator==
@@ -188,22 +183,31 @@ Parameters:
             other, a reference to another ScoreCard object to compare against.
 Return Value: True if both scorecards are equal; otherwise, false.
 Algorithm:
-            1) Use std::equal to compare the score_card entries of both scorecards.
-            2) Check if the keys and their corresponding values match.
+            1) Compare the filled categories.
+            2) For each filled category, compare the points, round and winner.
 Reference: none
-Optional: cppreference.com
 ********************************************************************* */
     bool operator==(const ScoreCard &other) const
     {
-        return std::equal(score_card.begin(), score_card.end(), other.score_card.begin(), other.score_card.end(),
-                          [](const auto &a, const auto &b)
-                          {
-                              return a.first == b.first && a.second == b.second;
-                          });
-    }
-
-    ScoreCard(const map<Category, optional<ScoreCardEntry>> &score_card) : score_card(score_card)
-    {
+        if (filled_mask != other.filled_mask)
+        {
+            return false;
+        }
+        for (int i = 0; i < NUM_CATEGORIES; i++)
+        {
+            const ScoreSlot &slot = slots[i];
+            const ScoreSlot &other_slot = other.slots[i];
+            if (slot.player == NO_PLAYER)
+            {
+                continue;
+            }
+            if (slot.points != other_slot.points || slot.round != other_slot.round ||
+                slot.player != other_slot.player)
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
 
@@ -213,53 +217,91 @@ Purpose: To add a score entry to the specified category with points, winner, and
 Parameters:
             category, a Category enum value indicating the category to add to.
             points, an integer representing the score points for this entry.
-            winner, a shared_ptr to the Player who won this entry.
+            player, an integer. It is the index of the player who won this entry.
             round, an integer representing the round number.
 Return Value: A new ScoreCard object with the updated entry.
 Algorithm:
             1) Check if the specified category already has an entry.
             2) If it does, throw an exception.
-            3) Create a new scorecard map and add the entry.
-            4) Return the new ScoreCard object.
+            3) Throw if the points are not from 0 to 50 or the player index is not 0 or 1.
+            4) Copy the scorecard, fill the slot, set its bit and add the points to the winner's total
+               and fill count.
+            5) Update the cached leader.
+            6) Return the new ScoreCard object.
 Reference: none
-Optional: cppreference.com
 ********************************************************************* */
-    ScoreCard add_entry(const Category category, const int points, const shared_ptr<Player> &winner,
-                        const int round) const
+    ScoreCard add_entry(const Category category, const int points, const int player, const int round) const
     {
-        if (score_card.at(category).has_value())
+        if (filled_mask & category_bit(category))
         {
             throw invalid_argument("Category already has a score card entry");
         }
+        if (points < 0 || points > 50)
+        {
+            throw invalid_argument("Score card entry points must be from 0 to 50");
+        }
+        if (player < 0 || player >= NUM_PLAYERS)
+        {
+            throw invalid_argument("Score card entry belongs to neither player");
+        }
 
-        map<Category, optional<ScoreCardEntry>> new_score_card = score_card;
-        new_score_card[category].emplace(ScoreCardEntry{points, winner, round});
-        return ScoreCard(new_score_card);
+        ScoreCard new_score_card = *this;
+        new_score_card.slots[static_cast<int>(category) - 1] =
+            ScoreSlot{static_cast<uint8_t>(points), static_cast<int8_t>(player), static_cast<uint16_t>(round)};
+        new_score_card.filled_mask |= category_bit(category);
+        new_score_card.totals[player] += points;
+        new_score_card.fill_counts[player]++;
+        new_score_card.update_leader();
+        return new_score_card;
     }
 
 
 /* *********************************************************************
 Function Name: add_entry
-Purpose: To automatically add a score entry for the max scoring category based on dice roll.
+Purpose: To automatically add a score entry for the best category based on dice roll.
 Parameters:
             round, an integer representing the round number.
-            winner, a shared_ptr to the Player who won this entry.
-            dice, a vector of integers representing the rolled dice values.
+            player, an integer. It is the index of the player who won this entry.
+            dice, a Hand holding the rolled dice values.
 Return Value: A new ScoreCard object with the updated entry.
 Algorithm:
-            1) Get the maximum scoring category based on the current dice.
-            2) Check if the category is already filled.
-            3) If not, create a new scorecard map, add the entry, and return it.
+            1) Get the category to fill with the current dice.
+            2) If there is none, return the scorecard unchanged.
+            3) Otherwise add the entry and return the new scorecard.
 Reference: none
 ********************************************************************* */
-    ScoreCard add_entry(const int round, const shared_ptr<Player> &winner, const vector<int> &dice) const
+    ScoreCard add_entry(const int round, const int player, const Hand &dice) const
     {
-        auto max_category = get_max_scoring_category(dice);
-        if (!max_category.has_value())
+        TRACE_SPAN("ScoreCard::add_entry");
+        auto category = get_scoring_category(dice);
+        if (!category.has_value())
         {
             return *this;
         }
-        return add_entry(max_category.value(), get_score(dice, max_category.value()), winner, round);
+        return add_entry(category.value(), get_score(dice, category.value()), player, round);
+    }
+
+
+/* *********************************************************************
+Function Name: get_scoring_category
+Purpose: To choose the category add_entry fills with a final roll.
+Parameters:
+    - const Hand &dice: The final roll of the dice.
+Return Value:
+    - optional<Category>: The category to fill, or nullopt if no open category can be scored.
+Algorithm:
+        1) If a value table is loaded, pick the category with the highest score plus expected
+           points still to come from the categories left open.
+        2) Otherwise pick the highest scoring category.
+Reference: none
+********************************************************************* */
+    optional<Category> get_scoring_category(const Hand &dice) const
+    {
+        if (const ValueTable *values = ValueTable::loaded())
+        {
+            return values->get_best_category(get_open_mask(), dice);
+        }
+        return get_max_scoring_category(dice);
     }
 
 
@@ -267,49 +309,39 @@ Reference: none
 Function Name: get_max_scoring_category
 Purpose: To find the best scoring category based on the current dice roll.
 Parameters:
-    - const vector<int> &dice: The current roll of the dice.
+    - const Hand &dice: The current roll of the dice.
 Return Value:
     - optional<Category>: The category that yields the highest score based on the dice roll, or nullopt if no category can be scored.
 Algorithm:
-        1) Retrieve the list of open categories (categories that are unfilled).
-        2) Retrieve the list of applicable categories based on the current dice roll.
-        3) Find the intersection of open categories and applicable categories to determine which categories can be assigned a score.
-        4) If no assignable categories exist, return nullopt.
-        5) Calculate scores for each assignable category.
-        6) Determine the category with the highest score and return it.
+        1) Intersect the applicability mask of the dice with the open mask; if nothing remains, return nullopt.
+        2) Look up the scores of the dice.
+        3) Return the category with the highest score, the later category on a tie.
 Reference: none
-Optional: cppreference.com
 ********************************************************************* */
-    optional<Category> get_max_scoring_category(const vector<int> &dice) const
+    optional<Category> get_max_scoring_category(const Hand &dice) const
     {
-        vector<Category> open_categories = get_open_categories();
-        vector<Category> applicable_categories = get_applicable_categories(dice);
-        vector<Category> assignable_categories = intersection(open_categories, applicable_categories);
+        TRACE_SPAN("ScoreCard::get_max_scoring_category");
+        const uint16_t assignable = get_applicable_mask(dice) & get_open_mask();
 
-        if (assignable_categories.empty())
+        if (assignable == 0)
         {
             return nullopt;
         }
 
-        map<Category, int> category_scores;
-        for (Category category : assignable_categories)
-        {
-            int score = get_score(dice, category);
-            category_scores[category] = score;
-        }
+        const HandScores hand_scores = get_hand_scores(dice);
 
-        Category max_category = Category::Ones;
+        int max_category = 0;
         int max_score = 0;
-        for (auto const &entry : category_scores)
+        for (int i = 0; i < NUM_CATEGORIES; i++)
         {
-            if (entry.second >= max_score)
+            if (((assignable >> i) & 1u) && hand_scores.scores[i] >= max_score)
             {
-                max_score = entry.second;
-                max_category = entry.first;
+                max_score = hand_scores.scores[i];
+                max_category = i;
             }
         }
 
-        return max_category;
+        return static_cast<Category>(max_category + 1);
     }
 
 
@@ -320,21 +352,35 @@ Parameters: None
 Return Value:
     - bool: True if all categories in the scorecard are filled; otherwise, false.
 Algorithm:
-        1) Iterate through all entries in the scorecard.
-        2) If any category is not filled (i.e., has no score entry), return false.
-        3) If all categories are filled, return true.
+        1) Check that the bit of every category is set in the filled mask.
 Reference: none
 ********************************************************************* */
     bool is_full() const
     {
-        for (auto const &entry : score_card)
+        return filled_mask == ALL_CATEGORIES_MASK;
+    }
+
+
+/* *********************************************************************
+Function Name: get_entry
+Purpose: To get the entry of a single category.
+Parameters:
+    - Category category: The category to look up.
+Return Value:
+    - optional<ScoreCardEntry>: The entry, or nullopt if the category is not filled.
+Algorithm:
+        1) Return nullopt if the category's slot is open.
+        2) Otherwise build the entry from the slot.
+Reference: none
+********************************************************************* */
+    optional<ScoreCardEntry> get_entry(const Category category) const
+    {
+        const ScoreSlot &slot = get_slot(category);
+        if (slot.player == NO_PLAYER)
         {
-            if (!entry.second.has_value())
-            {
-                return false;
-            }
+            return nullopt;
         }
-        return true;
+        return ScoreCardEntry{slot.points, slot.player, slot.round};
     }
 
 
@@ -345,25 +391,41 @@ Parameters: None
 Return Value:
     - vector<Category>: A vector containing all unfilled categories.
 Algorithm:
-        1) Initialize an empty vector to store open categories.
-        2) Iterate through the scorecard entries.
-        3) For each entry, check if it is unfilled; if so, add the category to the vector.
-        4) Return the vector of open categories, reversed to prioritize higher categories.
+        1) Walk the open mask from the highest category down, because higher categories are more
+           likely to be chosen.
+        2) Add every category whose bit is set.
 Reference: none
 ********************************************************************* */
     vector<Category> get_open_categories() const
     {
+        const uint16_t open_mask = get_open_mask();
+
         vector<Category> open_categories;
-        for (auto const &entry : score_card)
+        open_categories.reserve(NUM_CATEGORIES);
+        for (int i = NUM_CATEGORIES - 1; i >= 0; i--)
         {
-            if (!entry.second.has_value())
+            if ((open_mask >> i) & 1u)
             {
-                open_categories.push_back(entry.first);
+                open_categories.push_back(static_cast<Category>(i + 1));
             }
         }
+        return open_categories;
+    }
+
 
-        // Returning reversed category because higher categories are more likely to be chosen
-        return reversed(open_categories);
+/* *********************************************************************
+Function Name: get_open_mask
+Purpose: To get the unfilled categories as a 12-bit mask.
+Parameters: None
+Return Value:
+    - uint16_t: A mask with category_bit(category) set for every unfilled category.
+Algorithm:
+        1) Invert the filled mask within the 12 category bits.
+Reference: none
+********************************************************************* */
+    uint16_t get_open_mask() const
+    {
+        return static_cast<uint16_t>(~filled_mask & ALL_CATEGORIES_MASK);
     }
 
 
@@ -371,27 +433,27 @@ Reference: none
 Function Name: get_possible_categories
 Purpose: To determine which categories are possible to score based on the current dice roll.
 Parameters:
-    - const vector<int> &dice: The current roll of the dice.
+    - const Hand &dice: The current roll of the dice.
 Return Value:
     - vector<Category>: A vector of categories that can be scored with the given dice roll.
 Algorithm:
-        1) Retrieve the list of open categories.
-        2) Initialize an empty vector for possible categories.
-        3) For each open category, check if it is a possible category based on the current dice roll.
-        4) If a category is possible, add it to the vector of possible categories.
-        5) Return the vector of possible categories.
+        1) Get the mask of open categories that are possible with the dice.
+        2) Add the category of every set bit to the vector, from Yahtzee down to Ones like get_open_categories.
+        3) Return the vector of possible categories.
 Reference: none
 ********************************************************************* */
-    vector<Category> get_possible_categories(const vector<int> &dice) const
+    vector<Category> get_possible_categories(const Hand &dice) const
     {
-        vector<Category> open_categories = get_open_categories();
+        TRACE_SPAN("ScoreCard::get_possible_categories");
+        const uint16_t possible_mask = get_possible_category_mask(dice);
 
         vector<Category> possible_categories;
-        for (Category category : open_categories)
+        possible_categories.reserve(NUM_CATEGORIES);
+        for (int i = NUM_CATEGORIES - 1; i >= 0; i--)
         {
-            if (is_possible_category(dice, category))
+            if ((possible_mask >> i) & 1u)
             {
-                possible_categories.push_back(category);
+                possible_categories.push_back(static_cast<Category>(i + 1));
             }
         }
 
@@ -399,33 +461,37 @@ Reference: none
     }
 
 
+/* *********************************************************************
+Function Name: get_possible_category_mask
+Purpose: To get the open categories that are possible with the dice as a 12-bit mask.
+Parameters:
+    - const Hand &dice: The current roll of the dice.
+Return Value:
+    - uint16_t: The possibility mask of the dice intersected with the open mask.
+Algorithm:
+        1) AND the two masks.
+Reference: none
+********************************************************************* */
+    uint16_t get_possible_category_mask(const Hand &dice) const
+    {
+        return get_possible_mask(dice) & get_open_mask();
+    }
+
+
 /* *********************************************************************
 Function Name: get_player_score
 Purpose: To calculate the total score for a given player based on their filled categories in the scorecard.
 Parameters:
-    - const shared_ptr<Player> &player: The player whose score is being calculated.
+    - int player: The index of the player whose score is being calculated.
 Return Value:
     - int: The total score of the player.
 Algorithm:
-        1) Initialize a variable to store the total score, starting at zero.
-        2) Iterate through the scorecard entries.
-        3) For each filled category, check if the winner matches the specified player.
-        4) If it does, add the points for that entry to the total score.
-        5) Return the total score.
+        1) Return the running total kept for the player.
 Reference: none
 ********************************************************************* */
-    int get_player_score(const shared_ptr<Player> &player) const
+    int get_player_score(const int player) const
     {
-        int total_score = 0;
-        for (auto const &entry : score_card)
-        {
-            // if that category is filled and the winner of that category is player
-            if (entry.second.has_value() && entry.second.value().winner == player)
-            {
-                total_score += entry.second.value().points;
-            }
-        }
-        return total_score;
+        return totals[player];
     }
 
 
@@ -433,12 +499,12 @@ Reference: none
 Function Name: get_player_scores
 Purpose: To generate a map of player scores for all players.
 Parameters:
-    - const vector<shared_ptr<Player>> &players: A vector containing all players in the game.
+    - const vector<shared_ptr<Player>> &players: A vector containing all players in the game, in index order.
 Return Value:
     - map<shared_ptr<Player>, int>: A map associating each player with their corresponding score.
 Algorithm:
         1) Initialize an empty map to store player scores.
-        2) For each player in the provided vector, retrieve their score using get_player_score.
+        2) For each player in the provided vector, retrieve the score of their index using get_player_score.
         3) Add the player and their score to the map.
         4) Return the map of player scores.
 Reference: none
@@ -446,141 +512,96 @@ Reference: none
     map<shared_ptr<Player>, int> get_player_scores(const vector<shared_ptr<Player>> &players) const
     {
         map<shared_ptr<Player>, int> player_scores;
-        for (const auto &player : players)
+        for (int i = 0; i < static_cast<int>(players.size()); i++)
         {
-            int player_score = get_player_score(player);
-            player_scores[player] = player_score;
+            player_scores[players[i]] = get_player_score(i);
         }
         return player_scores;
     }
 
 
 /* *********************************************************************
-Function Name: get_winner
-Purpose: To determine the winner of the game by comparing player scores.
-Parameters: None
+Function Name: get_fill_count
+Purpose: To get the number of categories a player has filled.
+Parameters:
+    - int player: The index of the player to look up.
 Return Value:
-    - optional<shared_ptr<Player>>: The player with the highest score, or nullopt if the scorecard is not full.
+    - int: The number of categories won by the player.
 Algorithm:
-        1) Initialize a variable to hold the winner, starting as nullopt.
-        2) Check if the scorecard is full; if not, return nullopt.
-        3) Retrieve the list of players and their scores.
-        4) Find the player with the highest score by iterating through the scores.
-        5) Return the player with the highest score.
+        1) Return the fill count kept for the player.
 Reference: none
-Optional: cppreference.com
 ********************************************************************* */
-    optional<shared_ptr<Player>> get_winner() const
+    int get_fill_count(const int player) const
     {
-        optional<shared_ptr<Player>> winner = nullopt;
-
-        if (!is_full())
-        {
-            return nullopt;
-        }
+        return fill_counts[player];
+    }
 
-        auto players = get_players();
-        auto player_scores = get_player_scores(players);
 
-        // find the player with the highest score
-        int max_score = 0;
-        for (auto const &entry : player_scores)
+/* *********************************************************************
+Function Name: get_leader
+Purpose: To get the player currently ahead.
+Parameters: None
+Return Value:
+    - optional<int>: The index of the player with the strictly highest score, or nullopt while the
+      scores are tied.
+Algorithm:
+        1) Return the leader cached by add_entry.
+Reference: none
+********************************************************************* */
+    optional<int> get_leader() const
+    {
+        if (leader == NO_PLAYER)
         {
-            if (entry.second > max_score)
-            {
-                max_score = entry.second;
-                winner = entry.first;
-            }
+            return nullopt;
         }
-
-        return winner;
+        return leader;
     }
 
 
 /* *********************************************************************
-Function Name: is_draw
-Purpose: To check if the game resulted in a draw between players.
+Function Name: get_winner
+Purpose: To determine the winner of the game by comparing player scores.
 Parameters: None
 Return Value:
-    - bool: True if there is a draw, false otherwise.
+    - optional<int>: The index of the player with the highest score, or nullopt if the scorecard is not
+      full or the game is a draw.
 Algorithm:
-        1) If the scorecard is not full, return false (no draw possible).
-        2) Retrieve the player scores.
-        3) Determine the maximum score among the players.
-        4) Count how many players have this maximum score.
-        5) Return true if more than one player has the maximum score; otherwise, return false.
+        1) Check if the scorecard is full; if not, return nullopt.
+        2) Return the current leader.
 Reference: none
 ********************************************************************* */
-    bool is_draw() const
+    optional<int> get_winner() const
     {
-        // If the scorecard is not full, there cannot be a draw
         if (!is_full())
         {
-            return false;
-        }
-
-        auto players = get_players();
-        auto player_scores = get_player_scores(players);
-
-        // find the player with the highest score
-        int max_score = 0;
-        for (auto const &entry : player_scores)
-        {
-            if (entry.second > max_score)
-            {
-                max_score = entry.second;
-            }
-        }
-
-        // check if there is a draw
-        int count = 0;
-        for (auto const &entry : player_scores)
-        {
-            if (entry.second == max_score)
-            {
-                count++;
-            }
+            return nullopt;
         }
-
-        return count > 1;
+        return get_leader();
     }
 
 
 /* *********************************************************************
-Function Name: get_players
-Purpose: To retrieve a list of all players who have entries in the scorecard.
+Function Name: is_draw
+Purpose: To check if the game resulted in a draw between players.
 Parameters: None
 Return Value:
-    - vector<shared_ptr<Player>>: A vector containing all players who have scored in the scorecard.
+    - bool: True if there is a draw, false otherwise.
 Algorithm:
-        1) Initialize an empty vector to store unique players.
-        2) Iterate through the scorecard entries.
-        3) For each entry, check if it has a value and if the player is not already in the list.
-        4) If both conditions are met, add the player to the vector.
-        5) Return the vector of players.
+        1) If the scorecard is not full, return false (no draw possible).
+        2) Return true if both players have entries and neither leads.
 Reference: none
 ********************************************************************* */
-    vector<shared_ptr<Player>> get_players() const
+    bool is_draw() const
     {
-        vector<shared_ptr<Player>> players;
-
-        // Loop through the scorecard and collect all unique players
-        for (auto const &entry : score_card)
-        {
-            // If a scorecard entry has a value and the player isn't already in the list, add the player
-            if (entry.second.has_value() && !contains(players, entry.second.value().winner))
-            {
-                players.push_back(entry.second.value().winner);
-            }
-        }
-        return players;
+        return is_full() && fill_counts[0] > 0 && fill_counts[1] > 0 && leader == NO_PLAYER;
     }
 
 
 /* *********************************************************************
 Function Name: get_string
 Purpose: To generate a formatted string representation of the scorecard for display.
-Parameters: None
+Parameters:
+    - const vector<shared_ptr<Player>> &players: The players the entries' indices refer to.
 Return Value:
     - string: A formatted string displaying categories, rounds, winners, and points in the scorecard.
 Algorithm:
@@ -591,21 +612,21 @@ Algorithm:
         5) Return the constructed string representation of the scorecard.
 Reference: none
 ********************************************************************* */
-    string get_string() const
+    string get_string(const vector<shared_ptr<Player>> &players) const
     {
         stringstream score_card_string;
         score_card_string << left << setw(20) << "Category" << setw(10) << "Round" << setw(15) << "Winner" << setw(10)
                           << "Points" << "\n";
         score_card_string << string(50, '-') << "\n";
-        for (auto const &entry : score_card)
+        for (const Category category : CATEGORIES)
         {
-            score_card_string << left << setw(20) << CATEGORY_NAMES.at(entry.first);
-            if (entry.second.has_value())
+            const ScoreSlot &slot = get_slot(category);
+            score_card_string << left << setw(20) << CATEGORY_NAMES.at(category);
+            if (slot.player != NO_PLAYER)
             {
-                ScoreCardEntry score_card_entry = entry.second.value();
-                score_card_string << setw(10) << to_string(score_card_entry.round)
-                                  << setw(15) << score_card_entry.winner->get_name()
-                                  << setw(10) << to_string(score_card_entry.points);
+                score_card_string << setw(10) << to_string(slot.round)
+                                  << setw(15) << players[slot.player]->get_name()
+                                  << setw(10) << to_string(slot.points);
             }
             else
             {
@@ -618,32 +639,49 @@ Reference: none
 
 
 private:
-    // Hashmap of categories to score card entries
-    const map<Category, optional<ScoreCardEntry>> score_card;
+    // Slot of each category, indexed by category value - 1
+    array<ScoreSlot, NUM_CATEGORIES> slots;
+
+    // category_bit of every filled category
+    uint16_t filled_mask;
+
+    // Sum of the points of each player's entries
+    array<int, NUM_PLAYERS> totals;
+
+    // Number of categories each player has filled
+    array<uint8_t, NUM_PLAYERS> fill_counts;
+
+    // Index of the player with the strictly highest total, or NO_PLAYER on a tie
+    int8_t leader;
+
+    // Slot of a category
+    const ScoreSlot &get_slot(const Category category) const
+    {
+        return slots[static_cast<int>(category) - 1];
+    }
+
+
+    // Recomputes the leader from the two running totals
+    void update_leader()
+    {
+        leader = totals[0] == totals[1] ? NO_PLAYER : static_cast<int8_t>(totals[0] > totals[1] ? 0 : 1);
+    }
 
 /* *********************************************************************
-Function Name: initialize_score_card
-Purpose: To create and initialize the scorecard for the game, setting all
-        categories to nullopt to indicate that no entries have been made yet.
+Function Name: initialize_slots
+Purpose: To create the slots of an empty scorecard.
 Parameters: None
-Return Value: A map where each key is a Category and the value is an
-            optional ScoreCardEntry, all initialized to nullopt.
+Return Value: An array of 12 slots, all open.
 Algorithm:
-        1) Create an empty map to hold the scorecard entries.
-        2) Loop through all predefined categories.
-        3) For each category, set its corresponding entry in the map
-            to nullopt, indicating it is currently unfilled.
-        4) Return the initialized scorecard map.
+        1) Mark every slot as having no player, no points and no round.
 Reference: None
-Optional: cppreference.com
 ********************************************************************* */
-    static map<Category, optional<ScoreCardEntry>> initialize_score_card()
+    static array<ScoreSlot, NUM_CATEGORIES> initialize_slots()
     {
-        map<Category, optional<ScoreCardEntry>> temp_score_card;
-        for (Category category : CATEGORIES)
-        {
-            temp_score_card[category] = nullopt;
-        }
-        return temp_score_card;
+        array<ScoreSlot, NUM_CATEGORIES> empty_slots;
+        empty_slots.fill(ScoreSlot{0, NO_PLAYER, 0});
+        return empty_slots;
     }
 };
+
+static_assert(is_trivially_copyable_v<ScoreCard>, "Copying a ScoreCard must be a plain memory copy");
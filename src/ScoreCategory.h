@@ -10,6 +10,8 @@
 
 #include <vector>
 #include "helper_functions.h"
+#include "Hand.h"
+#include "ScoreTable.h"
 
 using namespace std;
 
@@ -37,6 +39,12 @@ int get_score(const vector<int> &dice, Category category);
 
 bool is_applicable_category(const vector<int> &dice, Category category);
 
+vector<Category> get_applicable_categories(const Hand &dice);
+
+int get_score(const Hand &dice, Category category);
+
+bool is_applicable_category(const Hand &dice, Category category);
+
 // Mapping of category enums to their corresponding string names
 inline map<Category, string> CATEGORY_NAMES = {
     {Category::Ones, "Ones"},
@@ -52,6 +60,18 @@ inline map<Category, string> CATEGORY_NAMES = {
     {Category::FiveStraight, "Five Straight"},
     {Category::Yahtzee, "Yahtzee"}};
 
+// Bit of a category in a 12-bit category mask (Ones is bit 0, Yahtzee is bit 11)
+constexpr uint16_t category_bit(const Category category)
+{
+    return static_cast<uint16_t>(1u << (static_cast<int>(category) - 1));
+}
+
+// Mask with every category set
+constexpr uint16_t ALL_CATEGORIES_MASK = 0xFFF;
+
+// Number of open-category masks, 2^12
+constexpr int NUM_MASKS = 4096;
+
 // List of all categories for easy iteration
 const vector<Category> CATEGORIES = {
     Category::Ones,
@@ -68,6 +88,169 @@ const vector<Category> CATEGORIES = {
     Category::Yahtzee};
 
 
+/* *********************************************************************
+Function Name: lookup_hand_scores
+Purpose: To find the precomputed scores of a five-dice hand.
+Parameters:
+            dice, a vector of integers passed by reference. It holds the values of the rolled dice in any order.
+Return Value: A pointer to the hand's entry in HAND_SCORES, or nullptr if dice is not five values from 1 to 6.
+Algorithm:
+            1) Reject anything that is not exactly five dice.
+            2) Count the faces on the stack, rejecting values outside 1 to 6.
+            3) Return the table entry at the hand's compact id.
+Reference: None
+********************************************************************* */
+inline const HandScores *lookup_hand_scores(const vector<int> &dice)
+{
+    if (dice.size() != 5)
+    {
+        return nullptr;
+    }
+
+    int counts[7] = {0, 0, 0, 0, 0, 0, 0};
+    for (int die : dice)
+    {
+        if (die < 1 || die > 6)
+        {
+            return nullptr;
+        }
+        counts[die]++;
+    }
+    return &HAND_SCORES[hand_id(counts)];
+}
+
+
+/* *********************************************************************
+Function Name: get_applicable_mask
+Purpose: To get every category a hand can be scored in as a 12-bit category mask.
+Parameters:
+            dice, a Hand passed by reference. It holds the rolled dice.
+Return Value: The mask with the bit of every applicable category set.
+Algorithm:
+            1) Ones to Sixes are the face-presence byte itself.
+            2) A run of n faces is present when the presence byte ANDed with itself shifted by 1 to
+               n - 1 is not zero; that gives Four and Five Straight.
+            3) Three/Four of a Kind and Yahtzee come from the highest count, Full House from some
+               face showing exactly three times and another exactly twice.
+Reference: None
+********************************************************************* */
+constexpr uint16_t get_applicable_mask(const Hand &dice)
+{
+    const uint16_t faces = dice.faces();
+    const uint16_t four_run = faces & (faces >> 1) & (faces >> 2) & (faces >> 3);
+    const uint16_t five_run = four_run & (faces >> 4);
+
+    uint16_t mask = faces;
+    if (dice.faces_with_at_least(3) != 0)
+        mask |= category_bit(Category::ThreeOfAKind);
+    if (dice.faces_with_at_least(4) != 0)
+        mask |= category_bit(Category::FourOfAKind);
+    if (dice.faces_with_exactly(3) != 0 && dice.faces_with_exactly(2) != 0)
+        mask |= category_bit(Category::FullHouse);
+    if (four_run != 0)
+        mask |= category_bit(Category::FourStraight);
+    if (five_run != 0)
+        mask |= category_bit(Category::FiveStraight);
+    if (dice.faces_with_exactly(5) != 0)
+        mask |= category_bit(Category::Yahtzee);
+    return mask;
+}
+
+
+/* *********************************************************************
+Function Name: get_possible_mask
+Purpose: To get every category that can still be reached from the kept dice as a 12-bit category mask.
+Parameters:
+            dice, a Hand passed by reference. It holds the kept dice.
+Return Value: The mask with the bit of every possible category set; every category is possible with no dice kept.
+Algorithm:
+            1) Ones to Sixes are possible while a die is still to be rolled, and otherwise exactly
+               when their face is present.
+            2) Yahtzee needs a single face, Five Straight no repeats and not both 1 and 6, Four
+               Straight at most one repeat, Full House at most two faces with no more than three of one.
+            3) Three/Four of a Kind need some face on at least 3/4 dice less the dice still to roll.
+Reference: None
+********************************************************************* */
+constexpr uint16_t get_possible_mask(const Hand &dice)
+{
+    if (dice.empty())
+        return ALL_CATEGORIES_MASK;
+
+    const int size = dice.size();
+    const uint8_t faces = dice.faces();
+    const int unique = dice.count_unique();
+    const int repeats = size - unique;
+
+    uint16_t mask = size < 5 ? 0x3F : faces;
+    if (unique == 1)
+        mask |= category_bit(Category::Yahtzee);
+    if (repeats < 1 && (faces & 0x21) != 0x21)
+        mask |= category_bit(Category::FiveStraight);
+    if (repeats < 2)
+        mask |= category_bit(Category::FourStraight);
+    if (unique <= 2 && dice.faces_with_at_least(4) == 0)
+        mask |= category_bit(Category::FullHouse);
+    // With 5 - size dice still to roll, n of a kind needs a face on at least n - (5 - size) dice
+    if (size <= 2 || dice.faces_with_at_least(size - 1) != 0)
+        mask |= category_bit(Category::FourOfAKind);
+    if (size <= 3 || dice.faces_with_at_least(size - 2) != 0)
+        mask |= category_bit(Category::ThreeOfAKind);
+    return mask;
+}
+
+
+/* *********************************************************************
+Function Name: get_categories
+Purpose: To list the categories of a 12-bit category mask.
+Parameters:
+            mask, a 12-bit category mask.
+Return Value: A vector of the categories whose bit is set, from Ones to Yahtzee.
+Algorithm:
+            1) Add the category of every set bit to the vector.
+Reference: None
+********************************************************************* */
+inline vector<Category> get_categories(const uint16_t mask)
+{
+    vector<Category> categories;
+    categories.reserve(NUM_CATEGORIES);
+    for (int i = 0; i < NUM_CATEGORIES; i++)
+    {
+        if (mask & (1u << i))
+        {
+            categories.push_back(static_cast<Category>(i + 1));
+        }
+    }
+    return categories;
+}
+
+
+/* *********************************************************************
+Function Name: fits_hand
+Purpose: To check whether a vector of dice can be held in a Hand.
+Parameters:
+            dice, a vector of integers passed by reference.
+Return Value: true if dice holds at most five values from 1 to 6.
+Algorithm:
+            1) Check the size, then every value.
+Reference: None
+********************************************************************* */
+inline bool fits_hand(const vector<int> &dice)
+{
+    if (dice.size() > 5)
+    {
+        return false;
+    }
+    for (const int die : dice)
+    {
+        if (die < 1 || die > 6)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
 /* *********************************************************************
 Function Name: get_applicable_categories
 Purpose: To determine which scoring categories are applicable based on the rolled dice.
@@ -75,15 +258,20 @@ Parameters:
             dice, a vector of integers passed by reference. It holds the values of the rolled dice.
 Return Value: A vector of Category enums representing the applicable scoring categories.
 Algorithm:
-            1) Initialize an empty vector for applicable categories.
-            2) Iterate over all defined categories.
-            3) For each category, check if it is applicable using the is_applicable_category function.
-            4) If applicable, add the category to the vector.
-            5) Return the vector of applicable categories.
+            1) For up to five dice from 1 to 6, list the categories of the hand's applicability mask.
+            2) Otherwise, initialize an empty vector and check every category using the
+               is_applicable_category function.
+            3) If applicable, add the category to the vector.
+            4) Return the vector of applicable categories.
 Reference: None
 ********************************************************************* */
 inline vector<Category> get_applicable_categories(const vector<int> &dice)
 {
+    if (fits_hand(dice))
+    {
+        return get_categories(get_applicable_mask(Hand(dice)));
+    }
+
     vector<Category> applicable_categories;
     for (Category category : CATEGORIES)
     {
@@ -104,14 +292,20 @@ Parameters:
             category, an enum of type Category. It specifies the scoring category to evaluate.
 Return Value: An integer representing the score for the specified category. Returns 0 if the category is not applicable.
 Algorithm:
-            1) Check if the category is applicable using is_applicable_category.
-            2) If not applicable, return 0.
-            3) Use a switch statement to calculate the score based on the selected category.
-            4) Return the calculated score.
+            1) For a five-dice hand, return the score stored in the score table.
+            2) Otherwise, check if the category is applicable using is_applicable_category.
+            3) If not applicable, return 0.
+            4) Use a switch statement to calculate the score based on the selected category.
+            5) Return the calculated score.
 Reference: None
 ********************************************************************* */
 inline int get_score(const vector<int> &dice, Category category)
 {
+    if (const HandScores *hand = lookup_hand_scores(dice))
+    {
+        return hand->scores[static_cast<int>(category) - 1];
+    }
+
     if (!is_applicable_category(dice, category))
     {
         return 0;
@@ -158,13 +352,19 @@ Parameters:
             category, an enum of type Category. It specifies the scoring category to evaluate.
 Return Value: A boolean indicating whether the category is applicable for scoring.
 Algorithm:
-            1) Use a switch statement to evaluate the category.
-            2) For each category, use the appropriate helper function to check applicability.
-            3) Return true if applicable; otherwise, return false.
+            1) For up to five dice from 1 to 6, test the category's bit in the hand's applicability mask.
+            2) Otherwise, use a switch statement to evaluate the category.
+            3) For each category, use the appropriate helper function to check applicability.
+            4) Return true if applicable; otherwise, return false.
 Reference: None
 ********************************************************************* */
 inline bool is_applicable_category(const vector<int> &dice, Category category)
 {
+    if (fits_hand(dice))
+    {
+        return (get_applicable_mask(Hand(dice)) & category_bit(category)) != 0;
+    }
+
     switch (category)
     {
     case Category::Yahtzee:
@@ -208,8 +408,9 @@ Parameters:
 Return Value: A boolean value indicating whether the specified category can
    be achieved with the given dice rolls.
 Algorithm:
-            1) Check if the dice vector is empty. If it is, return true as any
-               category is possible.
+            1) For up to five dice from 1 to 6, test the category's bit in the
+               hand's possibility mask. Otherwise, check if the dice vector is
+               empty. If it is, return true as any category is possible.
             2) Calculate the number of available slots for additional dice rolls
                by subtracting the size of the dice vector from 5.
             3) Use a switch statement to evaluate the given category:
@@ -229,6 +430,8 @@ Reference: None
 ********************************************************************* */
 inline bool is_possible_category(const vector<int> &dice, Category category)
 {
+    if (fits_hand(dice))
+        return (get_possible_mask(Hand(dice)) & category_bit(category)) != 0;
     if (dice.empty())
         return true;
     int slots_left = 5 - dice.size();
@@ -263,3 +466,92 @@ inline bool is_possible_category(const vector<int> &dice, Category category)
         return true;
     };
 };
+
+
+/* *********************************************************************
+Function Name: get_hand_scores
+Purpose: To get every category score and the applicability bitmask of a hand.
+Parameters:
+            dice, a Hand passed by reference. It holds the dice to score.
+Return Value: A HandScores for the hand.
+Algorithm:
+            1) For five dice, return the precomputed entry at the hand's id.
+            2) For fewer dice, score the face counts directly.
+Reference: None
+********************************************************************* */
+inline HandScores get_hand_scores(const Hand &dice)
+{
+    if (dice.size() == 5)
+    {
+        return HAND_SCORES[dice.id()];
+    }
+    const int counts[7] = {0, dice.count(1), dice.count(2), dice.count(3), dice.count(4), dice.count(5), dice.count(6)};
+    return score_hand(counts);
+}
+
+
+/* *********************************************************************
+Function Name: get_applicable_categories
+Purpose: To determine which scoring categories are applicable to a hand.
+Parameters:
+            dice, a Hand passed by reference. It holds the rolled dice.
+Return Value: A vector of Category enums representing the applicable scoring categories.
+Algorithm:
+            1) List the categories of the hand's applicability mask.
+Reference: None
+********************************************************************* */
+inline vector<Category> get_applicable_categories(const Hand &dice)
+{
+    return get_categories(get_applicable_mask(dice));
+}
+
+
+/* *********************************************************************
+Function Name: get_score
+Purpose: To calculate the score of a hand in the chosen category.
+Parameters:
+            dice, a Hand passed by reference. It holds the rolled dice.
+            category, an enum of type Category. It specifies the scoring category to evaluate.
+Return Value: The score for the category, or 0 if the category is not applicable.
+Algorithm:
+            1) Look up the hand's scores and return the one for the category.
+Reference: None
+********************************************************************* */
+inline int get_score(const Hand &dice, Category category)
+{
+    return get_hand_scores(dice).scores[static_cast<int>(category) - 1];
+}
+
+
+/* *********************************************************************
+Function Name: is_applicable_category
+Purpose: To check if a given scoring category can be achieved with a hand.
+Parameters:
+            dice, a Hand passed by reference. It holds the rolled dice.
+            category, an enum of type Category. It specifies the scoring category to evaluate.
+Return Value: A boolean indicating whether the category is applicable for scoring.
+Algorithm:
+            1) Test the category's bit in the hand's applicability mask.
+Reference: None
+********************************************************************* */
+inline bool is_applicable_category(const Hand &dice, Category category)
+{
+    return (get_applicable_mask(dice) & category_bit(category)) != 0;
+}
+
+
+/* *********************************************************************
+Function Name: is_possible_category
+Purpose: To determine whether a scoring category is still achievable from the kept dice.
+Parameters:
+            dice, a Hand passed by reference. It holds the kept dice.
+            category, an enum of type Category. It specifies the scoring category to evaluate.
+Return Value: A boolean value indicating whether the category can be achieved.
+Algorithm:
+            1) Test the category's bit in the hand's possibility mask.
+Reference: None
+********************************************************************* */
+inline bool is_possible_category(const Hand &dice, Category category)
+{
+    return (get_possible_mask(dice) & category_bit(category)) != 0;
+}
@@ -0,0 +1,175 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+using namespace std;
+
+// Number of distinct sorted five-dice hands (multisets of 5 faces from 6), C(10, 5)
+constexpr int NUM_HANDS = 252;
+
+// Number of scoring categories; category i in the table is Category(i + 1)
+constexpr int NUM_CATEGORIES = 12;
+
+// Struct to hold every category score of one five-dice hand
+struct HandScores
+{
+    // Score for each category, indexed by category value - 1
+    array<uint8_t, NUM_CATEGORIES> scores;
+
+    // Bit i is set when category i + 1 is applicable to the hand
+    uint16_t applicable;
+};
+
+
+/* *********************************************************************
+Function Name: binomial
+Purpose: To compute the binomial coefficient n choose k at compile time.
+Parameters:
+            n, k, integers.
+Return Value: n choose k, or 0 when k is out of range.
+Algorithm:
+            1) Multiply and divide incrementally so every intermediate value is an integer.
+Reference: none
+********************************************************************* */
+constexpr int binomial(const int n, const int k)
+{
+    if (k < 0 || k > n)
+    {
+        return 0;
+    }
+    int result = 1;
+    for (int i = 1; i <= k; i++)
+    {
+        result = result * (n - k + i) / i;
+    }
+    return result;
+}
+
+
+/* *********************************************************************
+Function Name: hand_id
+Purpose: To map a five-dice hand, given as face counts, to its compact index in 0..251.
+Parameters:
+            counts, an array of 7 integers. counts[f] is how many dice show face f (counts[0] is unused).
+                The counts must add up to 5.
+Return Value: The index of the hand in HAND_SCORES.
+Algorithm:
+            1) Walk the dice in ascending order; the i-th die (0-based) with face f becomes the
+               strictly increasing value b = (f - 1) + i in 0..9.
+            2) Rank the resulting 5-subset of 0..9 with the combinatorial number system:
+               sum of C(b_i, i + 1).
+Reference: combinatorial number system (Knuth, TAOCP 7.2.1.3)
+********************************************************************* */
+constexpr int hand_id(const int counts[7])
+{
+    int id = 0;
+    int i = 0;
+    for (int face = 1; face <= 6; face++)
+    {
+        for (int c = 0; c < counts[face]; c++, i++)
+        {
+            id += binomial(face - 1 + i, i + 1);
+        }
+    }
+    return id;
+}
+
+
+/* *********************************************************************
+Function Name: score_hand
+Purpose: To compute every category score of a five-dice hand from its face counts.
+Parameters:
+            counts, an array of 7 integers. counts[f] is how many dice show face f.
+Return Value: A HandScores with the 12 scores and the applicability bitmask.
+Algorithm:
+            1) Ones to Sixes score the face times its count and apply when the face is present.
+            2) Three/Four of a Kind apply when some face appears 3/4 times and score the sum of all dice.
+            3) Full House applies to exactly a triple and a pair and scores 25.
+            4) Four/Five Straight apply when 4/5 consecutive faces are present and score 30/40.
+            5) Yahtzee applies to five of a kind and scores 50.
+Reference: none
+********************************************************************* */
+constexpr HandScores score_hand(const int counts[7])
+{
+    HandScores hand{};
+
+    int total = 0;
+    int max_count = 0;
+    bool has_two = false;
+    bool has_three = false;
+    int run = 0;
+    int longest_run = 0;
+    for (int face = 1; face <= 6; face++)
+    {
+        total += counts[face] * face;
+        max_count = counts[face] > max_count ? counts[face] : max_count;
+        has_two = has_two || counts[face] == 2;
+        has_three = has_three || counts[face] == 3;
+        run = counts[face] > 0 ? run + 1 : 0;
+        longest_run = run > longest_run ? run : longest_run;
+
+        hand.scores[face - 1] = static_cast<uint8_t>(counts[face] * face);
+    }
+
+    const bool applicable[NUM_CATEGORIES] = {
+        counts[1] > 0, counts[2] > 0, counts[3] > 0, counts[4] > 0, counts[5] > 0, counts[6] > 0,
+        max_count >= 3, max_count >= 4, has_two && has_three, longest_run >= 4, longest_run >= 5,
+        max_count == 5};
+    const int combination_scores[6] = {total, total, 25, 30, 40, 50};
+
+    for (int i = 0; i < NUM_CATEGORIES; i++)
+    {
+        if (i >= 6)
+        {
+            hand.scores[i] = static_cast<uint8_t>(applicable[i] ? combination_scores[i - 6] : 0);
+        }
+        if (applicable[i])
+        {
+            hand.applicable |= static_cast<uint16_t>(1u << i);
+        }
+    }
+    return hand;
+}
+
+
+/* *********************************************************************
+Function Name: build_hand_scores
+Purpose: To build the table of scores for all 252 sorted five-dice hands at compile time.
+Parameters: None
+Return Value: An array of HandScores indexed by hand_id.
+Algorithm:
+            1) Enumerate every non-decreasing sequence of five faces.
+            2) Count the faces, score the hand and store it at its hand_id.
+Reference: none
+********************************************************************* */
+constexpr array<HandScores, NUM_HANDS> build_hand_scores()
+{
+    array<HandScores, NUM_HANDS> table{};
+    for (int a = 1; a <= 6; a++)
+        for (int b = a; b <= 6; b++)
+            for (int c = b; c <= 6; c++)
+                for (int d = c; d <= 6; d++)
+                    for (int e = d; e <= 6; e++)
+                    {
+                        int counts[7] = {0, 0, 0, 0, 0, 0, 0};
+                        counts[a]++;
+                        counts[b]++;
+                        counts[c]++;
+                        counts[d]++;
+                        counts[e]++;
+                        table[hand_id(counts)] = score_hand(counts);
+                    }
+    return table;
+}
+
+// Scores and applicability of every five-dice hand, indexed by hand_id
+inline constexpr array<HandScores, NUM_HANDS> HAND_SCORES = build_hand_scores();
@@ -0,0 +1,235 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Number of spans each thread keeps; once a thread's buffer is full its oldest spans are overwritten
+constexpr size_t TRACE_BUFFER_SPANS = 1 << 16;
+
+// Struct to hold one finished span. The name must be a string literal, it is stored as a pointer.
+struct TraceSpanRecord
+{
+    const char *name;
+
+    // Start and duration in nanoseconds, the start counted from the first traced span of the program
+    uint64_t start;
+    uint64_t duration;
+};
+
+// The spans recorded by one thread, in a fixed-size ring
+struct TraceBuffer
+{
+    // Small sequential number of the thread, used as its track in the trace viewer
+    uint32_t thread_id = 0;
+
+    // Number of spans ever recorded; the newest span is at (recorded - 1) % TRACE_BUFFER_SPANS
+    uint64_t recorded = 0;
+
+    array<TraceSpanRecord, TRACE_BUFFER_SPANS> spans;
+
+    void record(const char *name, const uint64_t start, const uint64_t duration)
+    {
+        spans[recorded % TRACE_BUFFER_SPANS] = TraceSpanRecord{name, start, duration};
+        recorded++;
+    }
+};
+
+
+// Scoped tracing of the hot paths. A span is opened with TRACE_SPAN("name") and closed at the end of
+// the enclosing scope; it costs two clock reads and a store into the calling thread's ring buffer,
+// with no lock and no allocation. Spans are only compiled in when YAHTZEE_TRACE is defined; otherwise
+// TRACE_SPAN expands to nothing and tracing costs nothing.
+class Trace
+{
+public:
+    // Whether this program was built with tracing
+    static constexpr bool is_compiled_in()
+    {
+#ifdef YAHTZEE_TRACE
+        return true;
+#else
+        return false;
+#endif
+    }
+
+
+    // Nanoseconds since the first call, on the monotonic clock
+    static uint64_t now()
+    {
+        static const chrono::steady_clock::time_point epoch = chrono::steady_clock::now();
+        return static_cast<uint64_t>(
+            chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - epoch).count());
+    }
+
+
+/* *********************************************************************
+Function Name: thread_buffer
+Purpose: To get the calling thread's ring buffer.
+Parameters: None
+Return Value: A reference to the buffer.
+Algorithm:
+            1) On the thread's first span, create its buffer and register it so it outlives the thread.
+            2) Afterwards, return the thread's buffer without taking any lock.
+Reference: none
+********************************************************************* */
+    static TraceBuffer &thread_buffer()
+    {
+        thread_local TraceBuffer *buffer = register_buffer();
+        return *buffer;
+    }
+
+
+/* *********************************************************************
+Function Name: write_chrome_json
+Purpose: To export every recorded span in the Chrome trace_event format, which Perfetto and
+         chrome://tracing open directly.
+Parameters:
+            out, an ostream passed by reference. It receives the JSON document.
+Return Value: None
+Algorithm:
+            1) Name every thread's track.
+            2) Write each thread's spans, oldest first, as complete ("X") events with microsecond
+               timestamps kept to the nanosecond.
+Reference: the Chrome Trace Event Format document
+********************************************************************* */
+    static void write_chrome_json(ostream &out)
+    {
+        const lock_guard<mutex> lock(get_registry().registry_mutex);
+        const vector<unique_ptr<TraceBuffer>> &buffers = get_registry().buffers;
+
+        out << fixed << setprecision(3);
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+        bool first = true;
+        for (const unique_ptr<TraceBuffer> &buffer : buffers)
+        {
+            out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                << buffer->thread_id << ",\"args\":{\"name\":\"Thread " << buffer->thread_id << "\"}}";
+            first = false;
+
+            const uint64_t kept = min<uint64_t>(buffer->recorded, TRACE_BUFFER_SPANS);
+            for (uint64_t i = buffer->recorded - kept; i < buffer->recorded; i++)
+            {
+                const TraceSpanRecord &span = buffer->spans[i % TRACE_BUFFER_SPANS];
+                out << ",\n{\"name\":\"" << span.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id
+                    << ",\"ts\":" << span.start / 1000.0 << ",\"dur\":" << span.duration / 1000.0 << "}";
+            }
+        }
+        out << "\n]}" << endl;
+    }
+
+
+/* *********************************************************************
+Function Name: write_at_exit
+Purpose: To export the trace to a file when the program exits, including through exit().
+Parameters:
+            path, a string passed by reference. It is the file to write.
+Return Value: None
+Algorithm:
+            1) Remember the path in a static object whose destructor writes the trace; it is created
+               after the clock's epoch, so it is destroyed first.
+Reference: none
+********************************************************************* */
+    static void write_at_exit(const string &path)
+    {
+        struct ExitWriter
+        {
+            string path;
+
+            ~ExitWriter()
+            {
+                if (path.empty())
+                {
+                    return;
+                }
+                ofstream file(path);
+                write_chrome_json(file);
+                if (!file)
+                {
+                    cerr << "Could not write trace " << path << endl;
+                }
+            }
+        };
+
+        now();
+        get_registry();
+        static ExitWriter writer;
+        writer.path = path;
+    }
+
+
+private:
+    // Struct to hold every thread's buffer; buffers are never freed, so a trace can be written after
+    // its threads have exited
+    struct Registry
+    {
+        mutex registry_mutex;
+        vector<unique_ptr<TraceBuffer>> buffers;
+    };
+
+    static Registry &get_registry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    static TraceBuffer *register_buffer()
+    {
+        Registry &registry = get_registry();
+        const lock_guard<mutex> lock(registry.registry_mutex);
+        registry.buffers.push_back(make_unique<TraceBuffer>());
+        registry.buffers.back()->thread_id = static_cast<uint32_t>(registry.buffers.size());
+        return registry.buffers.back().get();
+    }
+};
+
+
+// A span from its construction to its destruction, recorded in the calling thread's buffer
+class TraceSpan
+{
+public:
+    explicit TraceSpan(const char *name) : name(name), start(Trace::now())
+    {
+    }
+
+    TraceSpan(const TraceSpan &) = delete;
+    TraceSpan &operator=(const TraceSpan &) = delete;
+
+    ~TraceSpan()
+    {
+        Trace::thread_buffer().record(name, start, Trace::now() - start);
+    }
+
+private:
+    const char *name;
+    const uint64_t start;
+};
+
+
+#ifdef YAHTZEE_TRACE
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SPAN(name) const TraceSpan TRACE_CONCAT(trace_span_, __LINE__)(name)
+#else
+#define TRACE_SPAN(name) ((void)0)
+#endif
@@ -8,8 +8,10 @@
 */
 #pragma once
 
+#include "Journal.h"
 #include "Player.h"
 #include "ScoreCard.h"
+#include "Trace.h"
 #include "helper_functions.h"
 #include <memory>
 
@@ -22,16 +24,16 @@ Purpose: To manage a player's turn in the Yahtzee game, allowing them to roll di
 Parameters:
             player, a shared pointer to a Player object. It represents the player whose turn is being played.
             score_card, a constant reference to a ScoreCard object. It holds the scoring information and possible categories.
-Return Value: A vector of integers representing the dice the player kept at the end of their turn.
+Return Value: A Hand holding the dice the player kept at the end of their turn.
 Algorithm:
-            1) Initialize an empty vector to hold kept dice and set the current roll count to 1.
+            1) Initialize an empty Hand to hold kept dice and set the current roll count to 1.
             2) Loop until the player has rolled 3 times or has kept all 5 dice:
                 a) Display the current roll number and available scoring categories.
                 b) Display the player's current kept dice.
-                c) Get new dice rolls based on the number of dice not kept.
+                c) Get new dice rolls based on the number of dice not kept, and journal them.
                 d) Update potential scoring categories based on the new dice rolls.
                 e) Check if the player wants to end their turn or seek help, and handle those cases.
-                f) Allow the player to select which dice to keep and update the kept dice vector.
+                f) Allow the player to select which dice to keep and update the kept dice; journal the stand or keep.
                 g) If all dice are kept, end the turn early.
                 h) Optionally display the player's category pursuit and target.
             3) Output the final set of kept dice for the player.
@@ -42,12 +44,14 @@ c
 class Turn
 {
 public:
-    static vector<int> play_turn(const shared_ptr<Player> &player,
-                                 const ScoreCard &score_card)
+    static Hand play_turn(const shared_ptr<Player> &player,
+                          const ScoreCard &score_card)
     {
+        TRACE_SPAN("Turn::play_turn");
 
-        vector<int> kept_dice = {};
+        Hand kept_dice;
         int current_roll = 1;
+        Journal *journal = Journal::active();
 
         while (current_roll <= 3)
         {
@@ -59,13 +63,17 @@ public:
             auto potential_categories = score_card.get_possible_categories(kept_dice);
             show_categories(potential_categories);
 
-            cout << player->get_name() << "'s current dice: " << to_string_vector(kept_dice) << '\n'
+            cout << player->get_name() << "'s current dice: " << to_string_hand(kept_dice) << '\n'
                  << endl;
 
             // Get new dice rolls from the player (roll only the dice not kept)
-            vector<int> dice_rolls = player->get_dice_roll(5 - kept_dice.size());
-            cout << player->get_name() << " rolled: " << to_string_vector(dice_rolls) << '\n'
+            Hand dice_rolls = player->get_dice_roll(5 - kept_dice.size());
+            cout << player->get_name() << " rolled: " << to_string_hand(dice_rolls) << '\n'
                  << endl;
+            if (journal != nullptr)
+            {
+                journal->record_dice(JournalEvent::Roll, current_roll, dice_rolls);
+            }
 
             // Recalculate potential categories with the newly rolled dice and Show potential categories based on kept dice
             potential_categories = score_card.get_possible_categories(kept_dice);
@@ -78,34 +86,44 @@ public:
             {
                 cout << '\n';
                 cout << "End of turn." << endl;
-                kept_dice.insert(kept_dice.end(), dice_rolls.begin(), dice_rolls.end());
+                kept_dice = kept_dice + dice_rolls;
                 break;
             }
 
+            const int rolls_left = 3 - current_roll;
+
             // Check if the player wants help (only applies to the computer, where the help system is triggered)
             if (player->wants_help())
             {
-                auto help = Computer().get_help(score_card, kept_dice, dice_rolls);
+                auto help = Computer().get_help(score_card, kept_dice, dice_rolls, rolls_left);
                 cout << "Help: \n"
                      << help << '\n'
                      << endl;
             }
 
             // Check if the player decides to "stand" and keep their dice (ending the turn early)
-            if (player->wants_to_stand(score_card, kept_dice, dice_rolls))
+            if (player->wants_to_stand(score_card, kept_dice, dice_rolls, rolls_left))
             {
                 cout << player->get_name() << " chose to stand." << endl;
-                kept_dice.insert(kept_dice.end(), dice_rolls.begin(), dice_rolls.end());
+                kept_dice = kept_dice + dice_rolls;
+                if (journal != nullptr)
+                {
+                    journal->record_dice(JournalEvent::Stand, current_roll, kept_dice);
+                }
                 break;
             }
 
             // Determine which dice the player wants to keep based on the dice rolled and kept
-            auto dice_to_keep = player->get_dice_to_keep(score_card, dice_rolls, kept_dice);
-            cout << player->get_name() << " kept: " << to_string_vector(dice_to_keep) << '\n'
+            auto dice_to_keep = player->get_dice_to_keep(score_card, dice_rolls, kept_dice, rolls_left);
+            cout << player->get_name() << " kept: " << to_string_hand(dice_to_keep) << '\n'
                  << endl;
+            if (journal != nullptr)
+            {
+                journal->record_dice(JournalEvent::Keep, current_roll, dice_to_keep);
+            }
 
-            // Add the kept dice to the kept_dice vector
-            kept_dice.insert(kept_dice.end(), dice_to_keep.begin(), dice_to_keep.end());
+            // Add the kept dice to the kept_dice hand
+            kept_dice = kept_dice + dice_to_keep;
 
             // If all 5 dice are kept, the turn ends
             if (kept_dice.size() == 5)
@@ -116,25 +134,26 @@ public:
             }
 
             // Show user pursuit
-            optional<map<Category, Reason>> user_pursuit = player->get_category_pursuits(score_card, kept_dice);
-            if (user_pursuit.has_value())
+            const shared_ptr<const map<Category, Reason>> user_pursuit =
+                player->get_category_pursuits(score_card, kept_dice);
+            if (user_pursuit != nullptr)
             {
                 cout << player->get_name() << "'s pursuit: " << endl;
-                show_category_pursuits(user_pursuit.value());
+                show_category_pursuits(*user_pursuit);
             }
 
             // show the specific dice the player is aiming to roll for their target category
-            optional<pair<Category, vector<int>>> user_target = player->get_target(score_card, kept_dice);
+            optional<pair<Category, Hand>> user_target = player->get_target(score_card, kept_dice);
             if (user_target.has_value())
             {
-                cout << player->get_name() << "'s target: " << CATEGORY_NAMES[user_target.value().first] << " by rolling " << to_string_vector(user_target.value().second) << '\n'
+                cout << player->get_name() << "'s target: " << CATEGORY_NAMES[user_target.value().first] << " by rolling " << to_string_hand(user_target.value().second) << '\n'
                      << endl;
             }
 
             current_roll++;
         }
 
-        cout << player->get_name() << "'s final dice for round " << player->get_name() << ": " << to_string_vector(kept_dice) << '\n'
+        cout << player->get_name() << "'s final dice for round " << player->get_name() << ": " << to_string_hand(kept_dice) << '\n'
              << endl;
 
         return kept_dice;
@@ -0,0 +1,401 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Hand.h"
+#include "RerollTable.h"
+#include "ScoreCategory.h"
+#include "ScoreTable.h"
+#include "Trace.h"
+
+using namespace std;
+
+// Number of face-count combinations with 0 to 5 dice per face, 6^6
+constexpr int NUM_RADIXES = 46656;
+
+// Struct to hold one possible result of rolling some dice
+struct RollOutcome
+{
+    // Base-6 radix of the rolled dice (see DiceTables)
+    uint16_t radix;
+
+    // Probability of rolling exactly these dice in any order
+    double probability;
+};
+
+// Lookup tables shared by every solve. Every hand of 0 to 5 dice has an index in 0..461 (its position
+// in ALL_HANDS) and a radix: the face counts read as a base-6 number. The radix
+// of two hands together is the sum of their radixes, so the index of kept + rolled dice is a single
+// load from radix_to_index.
+struct DiceTables
+{
+    array<uint16_t, NUM_ALL_HANDS> radixes;
+    vector<uint16_t> radix_to_index;
+
+    // Every outcome of rolling n dice, for n from 0 to 5
+    array<vector<RollOutcome>, 6> outcomes;
+
+    // Radix of every sub-multiset of each hand, including the empty and the full hand
+    array<vector<uint16_t>, NUM_ALL_HANDS> subset_radixes;
+};
+
+// Expected values of a turn for one set of open categories
+struct TurnSolution
+{
+    // Points of each five-dice hand (by hand index) when scored in the best open category
+    array<double, NUM_ALL_HANDS> final_value;
+
+    // Expected final points when the hand at an index is kept and one roll is left
+    array<double, NUM_ALL_HANDS> one_roll_left;
+
+    // Expected final points when the hand at an index is kept and two rolls are left
+    array<double, NUM_ALL_HANDS> two_rolls_left;
+
+    // Expected final points of the whole turn, before the first roll
+    double turn_value;
+};
+
+class TurnSolver
+{
+public:
+/* *********************************************************************
+Function Name: radix
+Purpose: To get the base-6 radix of a hand.
+Parameters:
+            hand, a Hand passed by reference.
+Return Value: The sum of count(face) * 6^(face - 1).
+Algorithm:
+            1) Add up every face count weighted by its power of 6.
+Reference: none
+********************************************************************* */
+    static int radix(const Hand &hand)
+    {
+        return hand.count(1) + 6 * (hand.count(2) + 6 * (hand.count(3) + 6 * (hand.count(4) + 6 * (hand.count(5) + 6 * hand.count(6)))));
+    }
+
+
+/* *********************************************************************
+Function Name: index
+Purpose: To get the index of a hand of 0 to 5 dice in the solver's tables.
+Parameters:
+            hand, a Hand passed by reference.
+Return Value: An index from 0 to 461.
+Algorithm:
+            1) Look the hand's radix up in the radix to index table.
+Reference: none
+********************************************************************* */
+    static int index(const Hand &hand)
+    {
+        return get_tables().radix_to_index[radix(hand)];
+    }
+
+
+/* *********************************************************************
+Function Name: solve
+Purpose: To compute the expected values of every turn state for a set of open categories.
+Parameters:
+            open_mask, a 12-bit category mask. It holds the categories that can still be filled.
+Return Value: A reference to the solution, memoized per open mask for the whole process.
+Algorithm:
+            1) Compute the mask's solution with solve_uncached the first time any thread asks for it;
+               threads asking for the same mask meanwhile wait for it instead of solving it again.
+            2) Return the cached solution, which is never changed once built.
+Reference: none
+********************************************************************* */
+    static const TurnSolution &solve(const uint16_t open_mask)
+    {
+        // Every thread shares one solution per mask, at most 4096 * 11 KB in all
+        static array<once_flag, NUM_MASKS> solved;
+        static array<unique_ptr<const TurnSolution>, NUM_MASKS> solutions;
+
+        call_once(solved[open_mask], [open_mask]
+                  { solutions[open_mask] = make_unique<const TurnSolution>(solve_uncached(open_mask)); });
+        return *solutions[open_mask];
+    }
+
+
+/* *********************************************************************
+Function Name: best_keep
+Purpose: To choose the dice to keep from a roll that maximize the expected final points.
+Parameters:
+            open_mask, a 12-bit category mask. It holds the categories that can still be filled.
+            kept_dice, a Hand. It holds the dice kept from earlier rolls, which can no longer be rerolled.
+            dice_rolls, a Hand. It holds the dice just rolled.
+            rolls_left, an integer. It is the number of rolls still allowed after this one.
+Return Value: The sub-multiset of dice_rolls to keep; keeping all of them means standing.
+Algorithm:
+            1) Find the position of the best choice among the sub-multisets of the roll.
+            2) Return that sub-multiset.
+Reference: none
+********************************************************************* */
+    static Hand best_keep(const uint16_t open_mask, const Hand &kept_dice, const Hand &dice_rolls,
+                          const int rolls_left)
+    {
+        return subset(dice_rolls, best_keep_choice(open_mask, kept_dice, dice_rolls, rolls_left));
+    }
+
+
+/* *********************************************************************
+Function Name: best_keep_choice
+Purpose: To choose the dice to keep from a roll, as a position in the roll's list of sub-multisets.
+Parameters:
+            open_mask, a 12-bit category mask. It holds the categories that can still be filled.
+            kept_dice, a Hand. It holds the dice kept from earlier rolls.
+            dice_rolls, a Hand. It holds the dice just rolled.
+            rolls_left, an integer. It is the number of rolls still allowed after this one.
+Return Value: An index into subset_radixes of the roll; the last position is the whole roll.
+Algorithm:
+            1) With no rolls left, keep everything.
+            2) Otherwise evaluate every sub-multiset of the roll by the expected value of the resulting
+               kept dice with rolls_left rolls to go.
+            3) Return the best one, preferring to keep more dice when values tie.
+Reference: none
+********************************************************************* */
+    static int best_keep_choice(const uint16_t open_mask, const Hand &kept_dice, const Hand &dice_rolls,
+                                const int rolls_left)
+    {
+        const DiceTables &tables = get_tables();
+        const vector<uint16_t> &subsets = tables.subset_radixes[index(dice_rolls)];
+        if (rolls_left <= 0)
+        {
+            return static_cast<int>(subsets.size()) - 1;
+        }
+
+        const TurnSolution &solution = solve(open_mask);
+        const array<double, NUM_ALL_HANDS> &expected = rolls_left >= 2 ? solution.two_rolls_left
+                                                                         : solution.one_roll_left;
+
+        const int kept_radix = radix(kept_dice);
+        int best_choice = 0;
+        int best_size = 0;
+        double best_value = -1;
+        for (int choice = 0; choice < static_cast<int>(subsets.size()); choice++)
+        {
+            const int size = ALL_HANDS[tables.radix_to_index[subsets[choice]]].size();
+            const double value = expected[tables.radix_to_index[kept_radix + subsets[choice]]];
+            // Values closer than rounding error count as ties
+            if (value > best_value + 1e-9 || (value > best_value - 1e-9 && size > best_size))
+            {
+                best_value = value;
+                best_choice = choice;
+                best_size = size;
+            }
+        }
+        return best_choice;
+    }
+
+
+/* *********************************************************************
+Function Name: subset
+Purpose: To get one of the sub-multisets of a roll by its position.
+Parameters:
+            dice_rolls, a Hand. It holds the dice rolled.
+            choice, an integer. It is a position in the roll's list of sub-multisets.
+Return Value: The sub-multiset as a Hand.
+Algorithm:
+            1) Look the radix up in the roll's sub-multiset list and map it back to a hand.
+Reference: none
+********************************************************************* */
+    static Hand subset(const Hand &dice_rolls, const int choice)
+    {
+        const DiceTables &tables = get_tables();
+        return ALL_HANDS[tables.radix_to_index[tables.subset_radixes[index(dice_rolls)][choice]]];
+    }
+
+
+/* *********************************************************************
+Function Name: get_tables
+Purpose: To get the lookup tables shared by every solve.
+Parameters: None
+Return Value: A reference to the DiceTables, built on first use.
+Algorithm:
+            1) Build the tables once in a thread-safe static initializer.
+Reference: none
+********************************************************************* */
+    static const DiceTables &get_tables()
+    {
+        static const DiceTables tables = build_tables();
+        return tables;
+    }
+
+
+private:
+/* *********************************************************************
+Function Name: solve_uncached
+Purpose: To compute the expected values of every turn state for a set of open categories.
+Parameters:
+            open_mask, a 12-bit category mask.
+Return Value: The TurnSolution for the mask.
+Algorithm:
+            1) Score every five-dice hand in its best open category. This is the category the
+               scorecard will fill, so it is the value of ending the turn with that hand.
+            2) For every kept hand, one roll left: average the final value over every outcome of
+               rolling the remaining dice, weighted by its probability.
+            3) For every kept hand, two rolls left: average over every outcome the best value with one
+               roll left of keeping some of the rolled dice.
+            4) The turn value averages, over every first roll of five dice, the best value with two
+               rolls left of keeping some of them.
+Reference: none
+********************************************************************* */
+    static TurnSolution solve_uncached(const uint16_t open_mask)
+    {
+        TRACE_SPAN("TurnSolver::solve_uncached");
+        const DiceTables &tables = get_tables();
+        TurnSolution solution{};
+
+        for (int i = 0; i < NUM_ALL_HANDS; i++)
+        {
+            const Hand &hand = ALL_HANDS[i];
+            if (hand.size() != 5)
+            {
+                continue;
+            }
+            const HandScores &hand_scores = HAND_SCORES[hand.id()];
+            const uint16_t assignable = hand_scores.applicable & open_mask;
+            int best = 0;
+            for (int c = 0; c < NUM_CATEGORIES; c++)
+            {
+                if ((assignable >> c) & 1u)
+                {
+                    best = hand_scores.scores[c] > best ? hand_scores.scores[c] : best;
+                }
+            }
+            solution.final_value[i] = best;
+        }
+
+        for (int i = 0; i < NUM_ALL_HANDS; i++)
+        {
+            const int kept_radix = tables.radixes[i];
+            double expected = 0;
+            for (const RollOutcome &outcome : tables.outcomes[5 - ALL_HANDS[i].size()])
+            {
+                expected += outcome.probability * solution.final_value[tables.radix_to_index[kept_radix + outcome.radix]];
+            }
+            solution.one_roll_left[i] = expected;
+        }
+
+        for (int i = 0; i < NUM_ALL_HANDS; i++)
+        {
+            solution.two_rolls_left[i] = expected_best_keep(tables, i, solution.one_roll_left);
+        }
+        solution.turn_value = expected_best_keep(tables, 0, solution.two_rolls_left);
+
+        return solution;
+    }
+
+
+/* *********************************************************************
+Function Name: expected_best_keep
+Purpose: To average, over every roll of the dice that are not kept, the value of the best choice of
+         dice to keep from that roll.
+Parameters:
+            tables, the DiceTables.
+            kept_index, an integer. It is the index of the dice already kept.
+            next_values, an array passed by reference. It holds the value of each kept hand after the choice.
+Return Value: The expected value.
+Algorithm:
+            1) For every outcome of rolling the remaining dice, take the maximum of next_values over
+               every sub-multiset of the outcome added to the kept dice.
+            2) Weight each maximum by the outcome's probability and add them up.
+Reference: none
+********************************************************************* */
+    static double expected_best_keep(const DiceTables &tables, const int kept_index,
+                                     const array<double, NUM_ALL_HANDS> &next_values)
+    {
+        const int kept_radix = tables.radixes[kept_index];
+        double expected = 0;
+        for (const RollOutcome &outcome : tables.outcomes[5 - ALL_HANDS[kept_index].size()])
+        {
+            double best = 0;
+            for (const uint16_t subset_radix : tables.subset_radixes[tables.radix_to_index[outcome.radix]])
+            {
+                const double value = next_values[tables.radix_to_index[kept_radix + subset_radix]];
+                best = value > best ? value : best;
+            }
+            expected += outcome.probability * best;
+        }
+        return expected;
+    }
+
+
+/* *********************************************************************
+Function Name: build_tables
+Purpose: To build the hand indices, radixes, roll outcomes and sub-multisets used by the solver.
+Parameters: None
+Return Value: The filled DiceTables.
+Algorithm:
+            1) Walk every hand of 0 to 5 dice in ALL_HANDS order, which hand_combinations follows.
+            2) Record each hand's radix and the reverse radix to index mapping.
+            3) For every number of dice, give each outcome its multinomial probability
+               n! / (product of count! over the faces) / 6^n.
+            4) List the radix of every sub-multiset of each hand by choosing 0..count dice of each face.
+Reference: none
+********************************************************************* */
+    static DiceTables build_tables()
+    {
+        DiceTables tables;
+        tables.radix_to_index.assign(NUM_RADIXES, 0);
+
+        const int factorials[6] = {1, 1, 2, 6, 24, 120};
+
+        int next_index = 0;
+        for (int num_dice = 0; num_dice <= 5; num_dice++)
+        {
+            double all_outcomes = 1;
+            for (int i = 0; i < num_dice; i++)
+            {
+                all_outcomes *= 6;
+            }
+
+            for (const Hand &hand : hand_combinations(num_dice))
+            {
+                const int hand_radix = radix(hand);
+                tables.radixes[next_index] = static_cast<uint16_t>(hand_radix);
+                tables.radix_to_index[hand_radix] = static_cast<uint16_t>(next_index);
+                next_index++;
+
+                int orderings = factorials[num_dice];
+                for (int face = 1; face <= 6; face++)
+                {
+                    orderings /= factorials[hand.count(face)];
+                }
+                tables.outcomes[num_dice].push_back(RollOutcome{static_cast<uint16_t>(hand_radix), orderings / all_outcomes});
+            }
+        }
+
+        for (int i = 0; i < NUM_ALL_HANDS; i++)
+        {
+            const Hand &hand = ALL_HANDS[i];
+            vector<uint16_t> &subsets = tables.subset_radixes[i];
+            subsets.push_back(0);
+            int face_weight = 1;
+            for (int face = 1; face <= 6; face++)
+            {
+                // Extend every subset found so far with 1..count dice of this face
+                const size_t existing = subsets.size();
+                for (int c = 1; c <= hand.count(face); c++)
+                {
+                    for (size_t s = 0; s < existing; s++)
+                    {
+                        subsets.push_back(static_cast<uint16_t>(subsets[s] + c * face_weight));
+                    }
+                }
+                face_weight *= 6;
+            }
+        }
+
+        return tables;
+    }
+};
@@ -0,0 +1,180 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "Crc32.h"
+#include "Hand.h"
+#include "MappedFile.h"
+#include "ScoreCategory.h"
+
+using namespace std;
+
+// Struct at the start of a value file
+struct ValueHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t num_masks;
+};
+
+// The expected points still to come for every open-category mask, when one player fills every open
+// category alone and plays each turn to maximize the final total. Computed offline by backward induction
+// in tools/make_values.cpp and memory-mapped read-only. The file holds a float per mask, in mask order.
+class ValueTable
+{
+public:
+    static constexpr char MAGIC[4] = {'Y', 'V', 'A', 'L'};
+    static constexpr uint32_t VERSION = 1;
+
+/* *********************************************************************
+Function Name: ValueTable (Constructor)
+Purpose: To memory-map a value file and check that it matches this build.
+Parameters:
+            path, a string passed by reference. It is the path of the value file.
+Return Value: None
+Algorithm:
+            1) Map the whole file read-only (read it into memory on Windows).
+            2) Throw if the file has the wrong size, or the magic, version or mask count differ.
+            3) Checksum the whole file, so replays can name the table they were recorded with.
+Reference: none
+********************************************************************* */
+    explicit ValueTable(const string &path) : file(path, "value file")
+    {
+        const uint8_t *data = file.data();
+        const size_t size = file.size();
+
+        ValueHeader header{};
+        if (size >= sizeof(header))
+        {
+            memcpy(&header, data, sizeof(header));
+        }
+        if (size != sizeof(header) + static_cast<size_t>(NUM_MASKS) * sizeof(float) ||
+            memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+            header.num_masks != NUM_MASKS)
+        {
+            throw runtime_error("Invalid value file " + path);
+        }
+        values = data + sizeof(header);
+        checksum = crc32(data, size);
+    }
+
+    ValueTable(const ValueTable &) = delete;
+    ValueTable &operator=(const ValueTable &) = delete;
+
+
+/* *********************************************************************
+Function Name: load
+Purpose: To make a value file the one the scorecard consults when it fills a category.
+Parameters:
+            path, a string passed by reference. It is the path of the value file.
+Return Value: None
+Algorithm:
+            1) Map the file; the constructor throws if it is missing or invalid.
+            2) Replace the loaded table with it.
+Reference: none
+********************************************************************* */
+    static void load(const string &path)
+    {
+        loaded_table() = make_unique<ValueTable>(path);
+    }
+
+
+    // The loaded value table, or nullptr if none was loaded
+    static const ValueTable *loaded()
+    {
+        return loaded_table().get();
+    }
+
+
+    // The CRC-32 of the whole value file
+    uint32_t get_checksum() const
+    {
+        return checksum;
+    }
+
+
+/* *********************************************************************
+Function Name: get_value
+Purpose: To look up the expected points still to come with some categories open.
+Parameters:
+            open_mask, a 12-bit category mask. It holds the categories that can still be filled.
+Return Value: The expected points; 0 when no category is open.
+Algorithm:
+            1) Read the float stored for the mask.
+Reference: none
+********************************************************************* */
+    double get_value(const uint16_t open_mask) const
+    {
+        float value;
+        memcpy(&value, values + static_cast<size_t>(open_mask) * sizeof(float), sizeof(value));
+        return value;
+    }
+
+
+/* *********************************************************************
+Function Name: get_best_category
+Purpose: To choose the category to fill with a final roll by its points plus the value of what stays open.
+Parameters:
+            open_mask, a 12-bit category mask. It holds the categories that can still be filled.
+            dice, a Hand of five dice.
+Return Value: The open applicable category with the highest points now plus expected points to come,
+              the later category on a tie, or nullopt if no open category applies.
+Algorithm:
+            1) Intersect the applicability mask of the dice with the open mask; if nothing remains, return nullopt.
+            2) For every remaining category, add its score to the value of the mask without it.
+            3) Return the category with the highest total.
+Reference: none
+********************************************************************* */
+    optional<Category> get_best_category(const uint16_t open_mask, const Hand &dice) const
+    {
+        const uint16_t assignable = get_applicable_mask(dice) & open_mask;
+        if (assignable == 0)
+        {
+            return nullopt;
+        }
+
+        const HandScores hand_scores = get_hand_scores(dice);
+
+        int best_category = 0;
+        double best_total = -1;
+        for (int i = 0; i < NUM_CATEGORIES; i++)
+        {
+            if (!((assignable >> i) & 1u))
+            {
+                continue;
+            }
+            const double total = hand_scores.scores[i] + get_value(static_cast<uint16_t>(open_mask & ~(1u << i)));
+            if (total >= best_total)
+            {
+                best_total = total;
+                best_category = i;
+            }
+        }
+        return static_cast<Category>(best_category + 1);
+    }
+
+
+private:
+    MappedFile file;
+    const uint8_t *values = nullptr;
+    uint32_t checksum = 0;
+
+    static unique_ptr<ValueTable> &loaded_table()
+    {
+        static unique_ptr<ValueTable> table;
+        return table;
+    }
+};
@@ -0,0 +1,192 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Work-stealing distribution of the items 0..n-1 between a fixed number of workers.
+// Every worker starts with an equal slice of the items and takes small chunks from the front of its
+// own slice. A worker whose slice is empty steals the back half of another worker's slice. Each slice
+// is one packed atomic word (begin in the low 32 bits, end in the high 32 bits), so taking and
+// stealing are single compare-and-swap operations and no locks are used.
+class WorkScheduler
+{
+public:
+/* *********************************************************************
+Function Name: WorkScheduler (Constructor)
+Purpose: To split the items evenly between the workers.
+Parameters:
+            num_items, an unsigned integer. It is the number of items to process (below 2^32).
+            num_workers, an unsigned integer. It is the number of workers, at least 1.
+            chunk_size, an unsigned integer. It is the number of items a worker takes from its own slice at a time.
+Return Value: None
+Algorithm:
+            1) Give worker w the items from num_items * w / num_workers to num_items * (w + 1) / num_workers.
+Reference: none
+********************************************************************* */
+    WorkScheduler(const uint64_t num_items, const unsigned num_workers, const uint32_t chunk_size = 16)
+        : slices(num_workers), chunk_size(chunk_size)
+    {
+        for (unsigned w = 0; w < num_workers; w++)
+        {
+            slices[w].range.store(pack(static_cast<uint32_t>(num_items * w / num_workers),
+                                       static_cast<uint32_t>(num_items * (w + 1) / num_workers)));
+        }
+    }
+
+
+/* *********************************************************************
+Function Name: next
+Purpose: To get the next chunk of items for a worker.
+Parameters:
+            worker, an unsigned integer. It is the index of the asking worker.
+            begin, end, unsigned 32-bit integers passed by reference. They receive the chunk [begin, end).
+Return Value: true if a chunk was found, false once every slice is empty.
+Algorithm:
+            1) Take up to chunk_size items from the front of the worker's own slice.
+            2) If it is empty, visit the other workers in turn and steal the back half of the first
+               non-empty slice found, making it the worker's own slice, and go back to step 1.
+            3) Return false when no slice has items left.
+Reference: none
+********************************************************************* */
+    bool next(const unsigned worker, uint32_t &begin, uint32_t &end)
+    {
+        while (true)
+        {
+            if (take_front(slices[worker].range, begin, end))
+            {
+                return true;
+            }
+
+            bool stole = false;
+            for (size_t offset = 1; offset < slices.size() && !stole; offset++)
+            {
+                const size_t victim = (worker + offset) % slices.size();
+                uint32_t stolen_begin;
+                uint32_t stolen_end;
+                if (steal_back(slices[victim].range, stolen_begin, stolen_end))
+                {
+                    slices[worker].range.store(pack(stolen_begin, stolen_end));
+                    stole = true;
+                }
+            }
+            if (!stole)
+            {
+                return false;
+            }
+        }
+    }
+
+
+/* *********************************************************************
+Function Name: run
+Purpose: To process the items 0..n-1 on several threads.
+Parameters:
+            num_items, an unsigned integer. It is the number of items.
+            num_threads, an unsigned integer. It is the number of worker threads, at least 1.
+            process, a callable taking (worker index, item index). It is called once for every item.
+Return Value: None
+Algorithm:
+            1) Start one thread per worker; each takes chunks from the scheduler and processes every item.
+            2) Wait for every thread to finish.
+Reference: none
+********************************************************************* */
+    template <typename Process>
+    static void run(const uint64_t num_items, const unsigned num_threads, Process process)
+    {
+        WorkScheduler scheduler(num_items, num_threads);
+
+        vector<thread> workers;
+        workers.reserve(num_threads);
+        for (unsigned w = 0; w < num_threads; w++)
+        {
+            workers.emplace_back([&scheduler, &process, w]
+                                 {
+                uint32_t begin;
+                uint32_t end;
+                while (scheduler.next(w, begin, end))
+                {
+                    for (uint32_t item = begin; item < end; item++)
+                    {
+                        process(w, item);
+                    }
+                } });
+        }
+        for (thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+
+private:
+    // One worker's remaining items, on its own cache line so workers do not slow each other down
+    struct alignas(64) Slice
+    {
+        atomic<uint64_t> range{0};
+    };
+
+    vector<Slice> slices;
+    const uint32_t chunk_size;
+
+    static uint64_t pack(const uint32_t begin, const uint32_t end)
+    {
+        return (static_cast<uint64_t>(end) << 32) | begin;
+    }
+
+    // Takes up to chunk_size items from the front of a slice
+    bool take_front(atomic<uint64_t> &range, uint32_t &begin, uint32_t &end) const
+    {
+        uint64_t current = range.load();
+        while (true)
+        {
+            const uint32_t current_begin = static_cast<uint32_t>(current);
+            const uint32_t current_end = static_cast<uint32_t>(current >> 32);
+            if (current_begin >= current_end)
+            {
+                return false;
+            }
+            const uint32_t new_begin = current_end - current_begin > chunk_size ? current_begin + chunk_size : current_end;
+            if (range.compare_exchange_weak(current, pack(new_begin, current_end)))
+            {
+                begin = current_begin;
+                end = new_begin;
+                return true;
+            }
+        }
+    }
+
+    // Takes the back half (rounded up) of a slice
+    static bool steal_back(atomic<uint64_t> &range, uint32_t &begin, uint32_t &end)
+    {
+        uint64_t current = range.load();
+        while (true)
+        {
+            const uint32_t current_begin = static_cast<uint32_t>(current);
+            const uint32_t current_end = static_cast<uint32_t>(current >> 32);
+            if (current_begin >= current_end)
+            {
+                return false;
+            }
+            const uint32_t middle = current_begin + (current_end - current_begin) / 2;
+            if (range.compare_exchange_weak(current, pack(current_begin, middle)))
+            {
+                begin = middle;
+                end = current_end;
+                return true;
+            }
+        }
+    }
+};
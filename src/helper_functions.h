@@ -10,9 +10,15 @@
 
 #include <vector>
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <map>
-#include <random>
 #include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "DiceSource.h"
+#include "DiceEnumeration.h"
 
 using namespace std;
 
@@ -552,102 +558,66 @@ inline string trim(const string &s)
 
 
 /* *********************************************************************
-Function Name: get_dice_permutation
-Purpose: To generate all possible combinations of dice values for a given number of dice
+Function Name: parse_unsigned
+Purpose: To read a command line value as an unsigned 64-bit integer
 Parameters:
-            num_dice, an integer. It represents the number of dice
-Return Value: A vector of vectors containing all possible dice value combinations
+            option, a string passed by reference. It is the option the value belongs to, for the error
+            text, a string passed by reference. It is the value to parse
+Return Value: The parsed integer
 Algorithm:
-            1) Generate all combinations of numbers from 1 to 6, repeated num_dice times
+            1) Throw invalid_argument unless the text is one or more decimal digits; stoull alone would
+               accept a sign, leading spaces or trailing garbage
+            2) Parse it, throwing invalid_argument if it does not fit in 64 bits
 Reference: none
 ********************************************************************* */
-inline vector<vector<int>> get_dice_permutation(int num_dice)
+inline uint64_t parse_unsigned(const string &option, const string &text)
 {
-    vector<vector<int>> combinations;
-    vector<int> combination;
-    for (int i = 1; i <= 6; i++)
+    if (text.empty() || !all_of(text.begin(), text.end(), [](const unsigned char ch)
+                                { return isdigit(ch) != 0; }))
     {
-        combination.push_back(i);
-        combinations.push_back(combination);
-        combination.pop_back();
+        throw invalid_argument("Invalid value for " + option + ": " + text);
     }
-
-    for (int i = 1; i < num_dice; i++)
+    try
     {
-        vector<vector<int>> new_combinations;
-        for (const vector<int> &c : combinations)
-        {
-            for (int j = 1; j <= 6; j++)
-            {
-                vector<int> new_combination = c;
-                new_combination.push_back(j);
-                new_combinations.push_back(new_combination);
-            }
-        }
-        combinations = new_combinations;
+        return stoull(text);
+    }
+    catch (const out_of_range &)
+    {
+        throw invalid_argument("Value for " + option + " is too large: " + text);
     }
-
-    return combinations;
 }
 
 
 /* *********************************************************************
-Function Name: generate_combinations
-Purpose: To recursively generate combinations of dice values
+Function Name: parse_seconds
+Purpose: To read a command line value as a positive number of seconds
 Parameters:
-            n, an integer. It is the number of remaining dice to add
-            start, an integer. It represents the starting dice value
-            current, a vector of integers passed by reference. Holds the current combination
-            result, a vector of vector<int> passed by reference. Holds all combinations
-Return Value: none
+            option, a string passed by reference. It is the option the value belongs to, for the error
+            text, a string passed by reference. It is the value to parse
+Return Value: The parsed number of seconds
 Algorithm:
-            1) Base case: Add current combination to result
-            2) Recursive case: Generate dice values for remaining dice
+            1) Parse the whole text as a decimal number, throwing invalid_argument if it is not one,
+               has leading or trailing characters, or is not a finite number above zero
 Reference: none
 ********************************************************************* */
-inline void generate_combinations(int n, int start, vector<int> &current, vector<vector<int>> &result)
+inline double parse_seconds(const string &option, const string &text)
 {
-    if (n == 0)
+    size_t parsed = 0;
+    double seconds = 0;
+    try
     {
-        // If n dice have been "rolled", add the current combination to the result
-        result.push_back(current);
-        return;
+        seconds = stod(text, &parsed);
     }
-
-    // Loop through possible values for the dice (1 to 6)
-    for (int i = start; i <= 6; ++i)
+    catch (const logic_error &)
     {
-        current.push_back(i);
-        // Recursively generate combinations for the remaining n-1 dice
-        generate_combinations(n - 1, i, current, result);
-        // Backtrack and remove the last dice to explore other possibilities
-        current.pop_back();
+        parsed = 0;
     }
-}
-
-
-/* *********************************************************************
-Function Name: dice_combinations
-Purpose: To generate all possible combinations of dice rolls for a given
-         number of dice
-Parameters:
-            n, an integer passed by value. It represents the number of
-            dice to consider for combinations
-Return Value: A vector of vectors, where each inner vector represents a
-              unique dice roll combination
-Algorithm:
-            1) Create an empty vector to hold current combinations and
-               another for the final result
-            2) Use the helper function generate_combinations to recursively
-               add each combination to the result
-Reference: none
-********************************************************************* */
-inline vector<vector<int>> dice_combinations(int n)
-{
-    vector<vector<int>> result;
-    vector<int> current;
-    generate_combinations(n, 1, current, result);
-    return result;
+    if (parsed == 0 || parsed != text.size() || isspace(static_cast<unsigned char>(text[0])) || !isfinite(seconds) ||
+        seconds <= 0)
+    {
+        throw invalid_argument("Invalid value for " + option + ": " + text);
+    }
+    return seconds;
 }
 
 
@@ -657,15 +627,12 @@ Purpose: To generate a random boolean value
 Parameters: none
 Return Value: A boolean value that is either true or false
 Algorithm:
-            1) Use random_device and uniform distribution to return 0 or 1
+            1) Draw a bit from the calling thread's seeded DiceSource
 Reference: none
 ********************************************************************* */
 inline bool random_bool()
 {
-    random_device rd;
-    mt19937 gen(rd());
-    uniform_int_distribution<> dis(0, 1);
-    return dis(gen);
+    return DiceSource::thread_source().random_bool();
 }
 
 
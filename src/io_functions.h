@@ -14,8 +14,11 @@
 #include <sstream>
 #include <algorithm>
 #include <fstream>
+#include <iomanip>
 
+#include "Hand.h"
 #include "ScoreCategory.h"
+#include "Trace.h"
 
 struct Reason;
 using namespace std;
@@ -368,6 +371,43 @@ Reference: None
     }
 
 
+/* *********************************************************************
+Function Name: to_string_hand
+Purpose: Converts a hand of dice into a string representation for display purposes.
+Parameters:
+            hand, a Hand passed by reference. It holds the dice to be converted to a string.
+Return Value: A string representation of the dice in ascending order, formatted as a list.
+Algorithm:
+            1) List the dice of the hand in ascending order.
+            2) Format them the same way as to_string_vector.
+Reference: None
+********************************************************************* */
+    inline string to_string_hand(const Hand &hand)
+    {
+        return to_string_vector(hand.to_vector());
+    }
+
+
+/* *********************************************************************
+Function Name: to_string_odds
+Purpose: Describes how likely the next roll is to pay off for a pursued category.
+Parameters:
+            reason, a Reason passed by reference. It holds the category's pursuit.
+Return Value: A string such as " (a 4.6% chance of the maximum, 11.2 points expected)".
+Algorithm:
+            1) Format the chance of the maximum score as a percentage and the expected score, both
+               to one decimal place.
+Reference: None
+********************************************************************* */
+    inline string to_string_odds(const Reason &reason)
+    {
+        ostringstream odds;
+        odds << fixed << setprecision(1) << " (a " << 100 * reason.max_probability << "% chance of the maximum, "
+             << reason.expected_score << " points expected)";
+        return odds.str();
+    }
+
+
 /* *********************************************************************
 Function Name: show_categories
 Purpose: Displays the available scoring categories to the user for their selection.
@@ -427,12 +467,14 @@ Reference: None
 ********************************************************************* */
     inline string get_serial()
     {
+        TRACE_SPAN("io::get_serial");
         // Ask user for the serial file name
         string serial;
         cout << "Enter the name of the file you would like to load: ";
         getline(cin, serial);
 
-        ifstream file(serial);
+        // Binary mode so binary saves are read byte for byte
+        ifstream file(serial, ios::binary);
         if (!file)
         {
             cerr << "Error: File does not exist or cannot be opened." << endl;
@@ -454,30 +496,60 @@ Reference: None
     }
 
 
+/* *********************************************************************
+Function Name: read_file
+Purpose: Reads the whole content of a file without prompting the user.
+Parameters:
+            file_name, a string passed by reference. The path of the file to read.
+Return Value: A string containing the content of the file.
+Algorithm:
+            1) Attempt to open the specified file; throw if it cannot be opened.
+            2) Read the entire content of the file into a string and return it.
+Reference: None
+********************************************************************* */
+    inline string read_file(const string &file_name)
+    {
+        TRACE_SPAN("io::read_file");
+        ifstream file(file_name);
+        if (!file)
+        {
+            throw runtime_error("File does not exist or cannot be opened: " + file_name);
+        }
+        return string((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    }
+
+
 /* *********************************************************************
 Function Name: save_game_procedure
 Purpose: Saves the current game state to a specified file and allows the user to exit the program.
 Parameters:
-            serial, a string passed by value. It contains the serialized state of the current game.
+            serial, a string passed by reference. It contains the serialized state of the current game.
+            binary_serial, a string passed by reference. It contains the binary save of the same state.
 Return Value: None (void function).
 Algorithm:
             1) Ask the user if they wish to save the game and exit.
             2) If yes, prompt for the desired file name.
-            3) Write the current game state to the specified file.
+            3) Write the binary save if the file name ends in ".ybin", otherwise the text state.
             4) Confirm that the game has been saved successfully.
             5) Exit the program.
 Reference: None
 ********************************************************************* */
-    inline void save_game_procedure(const string &serial)
+    inline void save_game_procedure(const string &serial, const string &binary_serial)
     {
+        TRACE_SPAN("io::save_game_procedure");
         if (get_yes_no("Would you like to save the game and exit?"))
         {
             string file_name;
             cout << "Enter the name of the file you would like to save: ";
             getline(cin, file_name);
 
-            ofstream file(file_name);
-            file << serial;
+            const string binary_extension = ".ybin";
+            const bool binary = file_name.size() >= binary_extension.size() &&
+                                file_name.compare(file_name.size() - binary_extension.size(),
+                                                  binary_extension.size(), binary_extension) == 0;
+
+            ofstream file(file_name, binary ? ios::binary : ios::out);
+            file << (binary ? binary_serial : serial);
             file.close();
             cout << "Game saved successfully." << endl;
             exit(0);
@@ -523,17 +595,17 @@ Reference: None
         sort(reasons.begin(), reasons.end(), [](const Reason &a, const Reason &b)
              { return a.max_score < b.max_score; });
 
-        cout << "Current dice: " << to_string_vector(reasons[0].current_dice) << endl;
+        cout << "Current dice: " << to_string_hand(reasons[0].current_dice) << endl;
 
         for (const auto &[category, reason] : category_pursuits)
         {
             if (reason.min_score == 0)
             {
-                cout << "Can get " << CATEGORY_NAMES[reason.pursued_category] << " with a score of " << reason.max_score << " by rolling " << to_string_vector(reason.roll_to_get_max) << endl;
+                cout << "Can get " << CATEGORY_NAMES[reason.pursued_category] << " with a score of " << reason.max_score << " by rolling " << to_string_hand(reason.roll_to_get_max) << to_string_odds(reason) << endl;
                 continue;
             }
 
-            cout << "Can get " << CATEGORY_NAMES[reason.pursued_category] << " with a minimum score of " << reason.min_score << " by getting " << to_string_vector(reason.roll_to_get_min) << " and a maximum score of " << reason.max_score << " by rolling " << to_string_vector(reason.roll_to_get_max) << endl;
+            cout << "Can get " << CATEGORY_NAMES[reason.pursued_category] << " with a minimum score of " << reason.min_score << " by getting " << to_string_hand(reason.roll_to_get_min) << " and a maximum score of " << reason.max_score << " by rolling " << to_string_hand(reason.roll_to_get_max) << to_string_odds(reason) << endl;
         }
     }
 
@@ -1,24 +1,47 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <string>
 
+#include "BinarySave.h"
 #include "Computer.h"
 #include "Game.h"
 #include "Human.h"
+#include "Journal.h"
 #include "Player.h"
+#include "PolicyTable.h"
+#include "ValueTable.h"
+#include "Replay.h"
 #include "ScoreCard.h"
+#include "Trace.h"
 #include "io_functions.h"
 
 /* *********************************************************************
 Function Name: main
 Purpose: To execute the game loop for a Yahtzee game involving a human player and a computer player.
          The function manages the game's flow, including initialization of players, rounds, and saving/loading game state.
-Parameters: None
-Return Value: None
+Parameters:
+            argc, argv: the command line. Supported options are
+                --seed <n>       make every automatic roll, tie-breaker and first-player toss reproducible
+                --record <file>  play the seeded computer-vs-computer game headlessly and write its replay
+                --replay <file>  re-execute a recorded replay and verify it produces the same scorecard; it must be
+                                 given the --values table it was recorded with
+                --policy <file>  memory-map a policy table made by tools/make_policy for the computer's decisions
+                --values <file>  memory-map a value table made by tools/make_values to choose the scored categories
+                --journal <file> record every roll, keep, stand and score of the game in an append-only journal;
+                                 if the journal already holds a game, recover it and carry on from its last turn
+                --trace <file>   write a Chrome trace of the game when the program exits (needs -DYAHTZEE_TRACE)
+Return Value: 0 on success, 1 if a replay does not match or cannot be read, a file cannot be written or
+              the command line is invalid
 Algorithm:
+            0) Parse the command line, load the policy and value tables when --policy and --values are given
+               and arrange for the trace to be written at exit when --trace is given; handle --replay and
+               --record without starting an interactive game, and seed the dice when --seed is given.
             1) Create shared pointers for the human and computer players.
             2) Initialize a `Game` object, passing in the new scorecard, starting round, and list of players.
-            3) Check if the user wants to load a saved game. If so, get the serialized game data and reinitialize the game state using the deserialization process.
+            3) If the journal holds a game, recover it. Otherwise check if the user wants to load a saved game. If so, get the serialized game data and reinitialize the game state using the deserialization process.
+               Then start journaling when --journal is given.
             4) Enter a loop that continues until the game is over:
                   - Play a round of the game.
                   - After each round, save the game's current state.
@@ -28,8 +51,150 @@ Reference: None
 Shared pointer: OOP class and ChatGPT
 ********************************************************************* */
 
-int main()
+int main(int argc, char *argv[])
 {
+    optional<uint64_t> seed;
+    string record_file;
+    string replay_file;
+    string policy_file;
+    string values_file;
+    string journal_file;
+    string trace_file;
+
+    // Read the command line options
+    for (int i = 1; i < argc; i++)
+    {
+        const string option = argv[i];
+        if (i + 1 >= argc)
+        {
+            cerr << "Missing value for " << option << endl;
+            return 1;
+        }
+        if (option == "--seed")
+        {
+            try
+            {
+                seed = parse_unsigned(option, argv[++i]);
+            }
+            catch (const invalid_argument &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else if (option == "--record")
+        {
+            record_file = argv[++i];
+        }
+        else if (option == "--replay")
+        {
+            replay_file = argv[++i];
+        }
+        else if (option == "--policy")
+        {
+            policy_file = argv[++i];
+        }
+        else if (option == "--values")
+        {
+            values_file = argv[++i];
+        }
+        else if (option == "--journal")
+        {
+            journal_file = argv[++i];
+        }
+        else if (option == "--trace")
+        {
+            trace_file = argv[++i];
+        }
+        else
+        {
+            cerr << "Unknown option " << option << endl;
+            return 1;
+        }
+    }
+
+    // Write the spans of the whole run when the program exits, also when it exits after saving
+    if (!trace_file.empty())
+    {
+        if (!Trace::is_compiled_in())
+        {
+            cerr << "--trace needs a build with -DYAHTZEE_TRACE" << endl;
+            return 1;
+        }
+        Trace::write_at_exit(trace_file);
+    }
+
+    // Let the computer look its decisions up instead of solving them
+    if (!policy_file.empty())
+    {
+        try
+        {
+            PolicyTable::load(policy_file);
+        }
+        catch (const runtime_error &error)
+        {
+            cerr << error.what() << endl;
+            return 1;
+        }
+    }
+
+    // Fill each final roll's category by its points plus the expected points still to come
+    if (!values_file.empty())
+    {
+        try
+        {
+            ValueTable::load(values_file);
+        }
+        catch (const runtime_error &error)
+        {
+            cerr << error.what() << endl;
+            return 1;
+        }
+    }
+
+    // Re-execute a recorded game and check it still produces the same scorecard
+    if (!replay_file.empty())
+    {
+        bool matches = false;
+        try
+        {
+            matches = Replay::verify(read_file(replay_file));
+        }
+        catch (const exception &error)
+        {
+            cerr << error.what() << endl;
+            return 1;
+        }
+        if (matches)
+        {
+            cout << "Replay matches." << endl;
+            return 0;
+        }
+        cout << "Replay does not match." << endl;
+        return 1;
+    }
+
+    // Play a seeded computer-vs-computer game and save its replay
+    if (!record_file.empty())
+    {
+        const uint64_t record_seed = seed.value_or(DiceSource::thread_source().next());
+        ofstream file(record_file);
+        file << Replay::record(record_seed);
+        if (!file)
+        {
+            cerr << "Could not write " << record_file << endl;
+            return 1;
+        }
+        cout << "Recorded seed " << record_seed << " to " << record_file << endl;
+        return 0;
+    }
+
+    // Make the dice of the interactive game reproducible
+    if (seed.has_value())
+    {
+        Game::use_seed(seed.value());
+    }
+
     // Create shared pointers to Human and Computer objects using the `make_shared` function.
     auto human = make_shared<Human>();
     auto computer = make_shared<Computer>();
@@ -43,8 +208,26 @@ int main()
     cout << "Welcome to the yahtzee Game:\n";
     cout << endl;
 
+    // Recover the game of an existing journal, which continues after its last intact record
+    size_t journal_size = 0;
+    if (!journal_file.empty() && ifstream(journal_file, ios::binary | ios::ate).tellg() > 0)
+    {
+        try
+        {
+            const RecoveredGame recovered = Journal::recover(journal_file);
+            game = Game(recovered.score_card, recovered.round, players, recovered.finished_players);
+            journal_size = recovered.valid_size;
+        }
+        catch (const runtime_error &error)
+        {
+            cerr << error.what() << endl;
+            return 1;
+        }
+        cout << "Recovered the game from " << journal_file << " at round " << game.current_round << ".\n"
+             << endl;
+    }
     // Check if the user wants to load a previously saved game.
-    if (user_wants_to_load_game())
+    else if (user_wants_to_load_game())
     {
 
         // Get the serialized string game data from the user.
@@ -52,17 +235,59 @@ int main()
         string serial = get_serial();
 
         // Deserialize the game data and reinitialize the `game` object to restore the previous state.
-        game = Game::deserialize(serial);
+        // Binary saves are recognized by their magic bytes and rejected if they are corrupt.
+        const auto *bytes = reinterpret_cast<const uint8_t *>(serial.data());
+        if (BinarySave::is_binary_save(bytes, serial.size()))
+        {
+            try
+            {
+                game = Game::deserialize_binary(bytes, serial.size());
+            }
+            catch (const runtime_error &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else
+        {
+            game = Game::deserialize(serial);
+        }
+    }
+    // Journal every turn from here on; a new journal starts from the current game
+    if (!journal_file.empty())
+    {
+        try
+        {
+            Journal::start(make_unique<Journal>(journal_file, game.serialize_binary().data(), journal_size));
+        }
+        catch (const exception &error)
+        {
+            cerr << error.what() << endl;
+            return 1;
+        }
     }
+
     // Game loop: continue playing rounds until the game is over.
-    while (!game.is_over())
+    // A journal that can no longer be written or synced ends the game instead of losing turns silently.
+    try
     {
+        while (!game.is_over())
+        {
 
-        // Play a single round and update the `game` object.
-        game = game.play_round();
+            // Play a single round and update the `game` object.
+            game = game.play_round();
 
-        // Save the current state of the game after each round by serializing the game data.
-        save_game_procedure(game.serialize());
+            // Save the current state of the game after each round by serializing the game data
+            // (as text, or in the binary format when the file name ends in ".ybin").
+            const auto binary_serial = game.serialize_binary();
+            save_game_procedure(game.serialize(), string(binary_serial.begin(), binary_serial.end()));
+        }
+    }
+    catch (const runtime_error &error)
+    {
+        cerr << error.what() << endl;
+        return 1;
     }
 
     // Once the game is over, display the final scores.
@@ -79,6 +304,6 @@ int main()
         // If there is a winner, retrieve the winner from the scorecard.
         auto winner = game.score_card.get_winner();
 
-        cout << "The winner is " << winner.value()->get_name() << "!" << endl;
+        cout << "The winner is " << players[winner.value()]->get_name() << "!" << endl;
     }
 }
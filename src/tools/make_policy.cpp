@@ -0,0 +1,122 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Computer.h"
+#include "../PolicyTable.h"
+#include "../TurnSolver.h"
+
+/* *********************************************************************
+Function Name: build_mask_policy
+Purpose: To compute the Computer's decisions for one set of open categories.
+Parameters:
+            open_mask, a 12-bit category mask. It holds the categories that can still be filled.
+            policy, a pointer to POLICY_STRIDE bytes. It receives the decisions in PolicyTable's layout.
+Return Value: None
+Algorithm:
+            1) For every five-dice first roll, store the solver's keep choice with two rolls left.
+            2) For every (kept dice, rolled dice) pair of five dice, store the choice with one roll left.
+            3) For every kept hand, store the position of Computer::get_best_roll's target.
+Reference: none
+********************************************************************* */
+void build_mask_policy(const uint16_t open_mask, uint8_t *policy)
+{
+    for (const Hand &dice_rolls : hand_combinations(5))
+    {
+        policy[PolicyTable::position(dice_rolls)] =
+            static_cast<uint8_t>(TurnSolver::best_keep_choice(open_mask, EMPTY_HAND, dice_rolls, 2));
+    }
+
+    for (int num_kept = 0; num_kept <= 5; num_kept++)
+    {
+        for (const Hand &kept_dice : hand_combinations(num_kept))
+        {
+            for (const Hand &dice_rolls : hand_combinations(5 - num_kept))
+            {
+                policy[NUM_HANDS + PolicyTable::second_roll_index(kept_dice, dice_rolls)] =
+                    static_cast<uint8_t>(TurnSolver::best_keep_choice(open_mask, kept_dice, dice_rolls, 1));
+            }
+        }
+    }
+
+    // A full scorecard has no target; the game never asks for one
+    if (open_mask == 0)
+    {
+        return;
+    }
+    for (int i = 0; i < NUM_ALL_HANDS; i++)
+    {
+        const Hand best_roll = Computer::get_best_roll(open_mask, ALL_HANDS[i]);
+        policy[NUM_HANDS + NUM_SECOND_ROLLS + i] = static_cast<uint8_t>(PolicyTable::position(best_roll));
+    }
+}
+
+
+/* *********************************************************************
+Function Name: main
+Purpose: To solve every open-category mask offline and write the policy file the game memory-maps.
+Parameters:
+            argc, argv: the command line, make_policy <output file>
+Return Value: 0 on success, 1 if the command line is invalid or the file cannot be written
+Algorithm:
+            1) Split the 4096 masks between all hardware threads; each thread takes the next unsolved mask.
+            2) Write the header followed by every mask's decisions.
+Reference: none
+********************************************************************* */
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        cerr << "Usage: make_policy <output file>" << endl;
+        return 1;
+    }
+
+    vector<uint8_t> policies(static_cast<size_t>(NUM_MASKS) * POLICY_STRIDE);
+    atomic<int> next_mask(0);
+
+    const unsigned num_threads = max(1u, thread::hardware_concurrency());
+    vector<thread> workers;
+    for (unsigned t = 0; t < num_threads; t++)
+    {
+        workers.emplace_back([&]
+                             {
+            for (int mask = next_mask++; mask < NUM_MASKS; mask = next_mask++)
+            {
+                build_mask_policy(static_cast<uint16_t>(mask), &policies[static_cast<size_t>(mask) * POLICY_STRIDE]);
+            } });
+    }
+    for (thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    ofstream file(argv[1], ios::binary);
+    PolicyHeader header{};
+    memcpy(header.magic, PolicyTable::MAGIC, sizeof(header.magic));
+    header.version = PolicyTable::VERSION;
+    header.num_masks = NUM_MASKS;
+    header.stride = POLICY_STRIDE;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(policies.data()), static_cast<streamsize>(policies.size()));
+    if (!file)
+    {
+        cerr << "Could not write " << argv[1] << endl;
+        return 1;
+    }
+
+    cout << "Wrote " << NUM_MASKS << " policies to " << argv[1] << endl;
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../TurnSolver.h"
+#include "../ValueTable.h"
+
+// Struct to hold the value of a turn state and the chance that the turn ends without filling a category
+struct StateValue
+{
+    double value;
+    double no_fill;
+};
+
+/* *********************************************************************
+Function Name: best_keep_value
+Purpose: To average, over every roll of the dice that are not kept, the best state reachable by keeping
+         some of the rolled dice.
+Parameters:
+            tables, the solver's DiceTables.
+            kept_index, an integer. It is the index of the dice already kept.
+            next_states, an array passed by reference. It holds the state of each kept hand after the choice.
+Return Value: The expected value and no-fill chance under the best choices.
+Algorithm:
+            1) For every outcome of rolling the remaining dice, pick the sub-multiset of the outcome whose
+               kept hand has the highest value.
+            2) Weight the chosen state by the outcome's probability and add them up.
+Reference: none
+********************************************************************* */
+StateValue best_keep_value(const DiceTables &tables, const int kept_index,
+                           const array<StateValue, NUM_ALL_HANDS> &next_states)
+{
+    const int kept_radix = tables.radixes[kept_index];
+    StateValue expected{0, 0};
+    for (const RollOutcome &outcome : tables.outcomes[5 - ALL_HANDS[kept_index].size()])
+    {
+        const StateValue *best = nullptr;
+        for (const uint16_t subset_radix : tables.subset_radixes[tables.radix_to_index[outcome.radix]])
+        {
+            const StateValue &state = next_states[tables.radix_to_index[kept_radix + subset_radix]];
+            if (best == nullptr || state.value > best->value)
+            {
+                best = &state;
+            }
+        }
+        expected.value += outcome.probability * best->value;
+        expected.no_fill += outcome.probability * best->no_fill;
+    }
+    return expected;
+}
+
+
+/* *********************************************************************
+Function Name: evaluate_turn
+Purpose: To compute the value of one turn when the points to come after it are known.
+Parameters:
+            open_mask, a 12-bit category mask. It holds the categories open at the start of the turn.
+            values, a vector passed by reference. It holds the value of every mask with fewer categories open.
+            no_fill_value, a double. It is the value of ending the turn without filling a category, which
+            leaves the same categories open.
+Return Value: The expected value of the turn and the chance it ends without filling a category.
+Algorithm:
+            1) A five-dice hand is worth the best score of an open applicable category plus the value of
+               the mask without it; with no such category it is worth no_fill_value.
+            2) Average it over the outcomes of the last roll for every kept hand, then take the best
+               keep over the outcomes of the second roll, then over the first roll.
+Reference: none
+********************************************************************* */
+StateValue evaluate_turn(const uint16_t open_mask, const vector<double> &values, const double no_fill_value)
+{
+    const DiceTables &tables = TurnSolver::get_tables();
+    array<StateValue, NUM_ALL_HANDS> final_states{};
+    for (int i = 0; i < NUM_ALL_HANDS; i++)
+    {
+        const Hand &hand = ALL_HANDS[i];
+        if (hand.size() != 5)
+        {
+            continue;
+        }
+        const HandScores &hand_scores = HAND_SCORES[hand.id()];
+        const uint16_t assignable = hand_scores.applicable & open_mask;
+        if (assignable == 0)
+        {
+            final_states[i] = StateValue{no_fill_value, 1};
+            continue;
+        }
+        double best = 0;
+        for (int c = 0; c < NUM_CATEGORIES; c++)
+        {
+            if ((assignable >> c) & 1u)
+            {
+                best = max(best, hand_scores.scores[c] + values[open_mask & ~(1u << c)]);
+            }
+        }
+        final_states[i] = StateValue{best, 0};
+    }
+
+    array<StateValue, NUM_ALL_HANDS> one_roll_left{};
+    for (int i = 0; i < NUM_ALL_HANDS; i++)
+    {
+        const int kept_radix = tables.radixes[i];
+        for (const RollOutcome &outcome : tables.outcomes[5 - ALL_HANDS[i].size()])
+        {
+            const StateValue &state = final_states[tables.radix_to_index[kept_radix + outcome.radix]];
+            one_roll_left[i].value += outcome.probability * state.value;
+            one_roll_left[i].no_fill += outcome.probability * state.no_fill;
+        }
+    }
+
+    array<StateValue, NUM_ALL_HANDS> two_rolls_left{};
+    for (int i = 0; i < NUM_ALL_HANDS; i++)
+    {
+        two_rolls_left[i] = best_keep_value(tables, i, one_roll_left);
+    }
+    return best_keep_value(tables, 0, two_rolls_left);
+}
+
+
+/* *********************************************************************
+Function Name: solve_mask
+Purpose: To compute the expected points still to come with a set of categories open.
+Parameters:
+            open_mask, a 12-bit category mask with at least one category set.
+            values, a vector passed by reference. It holds the value of every mask with fewer categories open.
+Return Value: The expected points.
+Algorithm:
+            1) A turn that fills nothing leaves the same mask, so the value V solves V = turn value(V).
+            2) Start from V = 0. Evaluate the turn with the current V; with the choices made there fixed,
+               the turn value is linear in V, value + no_fill * (x - V), so solve that line for its fixed point.
+            3) Repeat until V stops changing; the choices settle after a few steps.
+Reference: Policy iteration (Howard, 1960)
+********************************************************************* */
+double solve_mask(const uint16_t open_mask, const vector<double> &values)
+{
+    double value = 0;
+    for (int step = 0; step < 100; step++)
+    {
+        const StateValue turn = evaluate_turn(open_mask, values, value);
+        const double next_value = (turn.value - turn.no_fill * value) / (1 - turn.no_fill);
+        if (fabs(next_value - value) < 1e-9)
+        {
+            return next_value;
+        }
+        value = next_value;
+    }
+    return value;
+}
+
+
+/* *********************************************************************
+Function Name: main
+Purpose: To solve the whole solitaire game offline and write the value file the game memory-maps.
+Parameters:
+            argc, argv: the command line, make_values <output file>
+Return Value: 0 on success, 1 if the command line is invalid or the file cannot be written
+Algorithm:
+            1) Solve the masks by backward induction, in order of the number of open categories; a mask
+               only needs masks with one category fewer, so every mask of a level is solved in parallel
+               on all hardware threads.
+            2) Write the header followed by the value of every mask as a float.
+Reference: none
+********************************************************************* */
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        cerr << "Usage: make_values <output file>" << endl;
+        return 1;
+    }
+
+    vector<vector<uint16_t>> levels(NUM_CATEGORIES + 1);
+    for (int mask = 0; mask < NUM_MASKS; mask++)
+    {
+        levels[bitset<NUM_CATEGORIES>(mask).count()].push_back(static_cast<uint16_t>(mask));
+    }
+
+    // No open category means no points to come
+    vector<double> values(NUM_MASKS, 0);
+    const unsigned num_threads = max(1u, thread::hardware_concurrency());
+    for (int level = 1; level <= NUM_CATEGORIES; level++)
+    {
+        const vector<uint16_t> &masks = levels[level];
+        atomic<size_t> next(0);
+        vector<thread> workers;
+        for (unsigned t = 0; t < num_threads; t++)
+        {
+            workers.emplace_back([&]
+                                 {
+                for (size_t i = next++; i < masks.size(); i = next++)
+                {
+                    values[masks[i]] = solve_mask(masks[i], values);
+                } });
+        }
+        for (thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    ofstream file(argv[1], ios::binary);
+    ValueHeader header{};
+    memcpy(header.magic, ValueTable::MAGIC, sizeof(header.magic));
+    header.version = ValueTable::VERSION;
+    header.num_masks = NUM_MASKS;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const double value : values)
+    {
+        const float stored = static_cast<float>(value);
+        file.write(reinterpret_cast<const char *>(&stored), sizeof(stored));
+    }
+    if (!file)
+    {
+        cerr << "Could not write " << argv[1] << endl;
+        return 1;
+    }
+
+    cout << "Wrote " << NUM_MASKS << " values to " << argv[1] << "; a whole game is worth "
+         << values[ALL_CATEGORIES_MASK] << " points" << endl;
+    return 0;
+}
@@ -0,0 +1,568 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Count every allocation, so each benchmark reports what it allocates per op. The counting operator new
+// adds a thread-local increment to every allocation, which is part of every number this program reports.
+#ifndef YAHTZEE_COUNT_ALLOCATIONS
+#define YAHTZEE_COUNT_ALLOCATIONS
+#endif
+#include "../AllocationStats.h"
+
+#include "../BatchScoring.h"
+#include "../BinarySave.h"
+#include "../Computer.h"
+#include "../GameEngine.h"
+#include "../Human.h"
+#include "../ScoreCard.h"
+
+/* *********************************************************************
+Function Name: do_not_optimize
+Purpose: To keep the compiler from removing a computation whose result is otherwise unused.
+Parameters:
+            value, the result to keep.
+Return Value: None
+Algorithm:
+            1) Pretend to read the value from memory with an empty assembly statement.
+Reference: Google Benchmark's DoNotOptimize
+********************************************************************* */
+template <typename T>
+inline void do_not_optimize(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const void *volatile sink;
+    sink = &value;
+#endif
+}
+
+
+// Struct to hold the fixed inputs every benchmark cycles through, so runs are comparable
+struct Corpus
+{
+    // Every five-dice roll, as Hands and as vectors
+    vector<Hand> rolls;
+    vector<vector<int>> roll_vectors;
+
+    // Every ordered roll of five dice (6^5 = 7776), as vectors and in batch form
+    vector<vector<int>> ordered_rolls;
+    DiceBatch ordered_dice;
+    FaceCountBatch ordered_counts;
+
+    // Every hand of 0 to 4 kept dice, as Hands and as vectors
+    vector<Hand> kept;
+    vector<vector<int>> kept_vectors;
+
+    // Every (kept dice, rolled dice) pair with one or more kept dice and five dice in total
+    vector<pair<Hand, Hand>> turn_states;
+
+    // Part-filled scorecards of a seeded game sequence, with their text and binary forms
+    vector<ScoreCard> score_cards;
+    vector<string> serials;
+    vector<array<uint8_t, BINARY_SAVE_SIZE>> binary_serials;
+
+    // The players the scorecards' indices refer to
+    vector<shared_ptr<Player>> players = {make_shared<Human>(), make_shared<Computer>()};
+};
+
+
+/* *********************************************************************
+Function Name: build_corpus
+Purpose: To build the benchmark inputs.
+Parameters: None
+Return Value: The Corpus.
+Algorithm:
+            1) Enumerate every roll, ordered roll, kept hand and (kept, rolled) pair.
+            2) Fill 64 scorecards with 0 to 11 categories from seeded dice, alternating the players.
+Reference: none
+********************************************************************* */
+Corpus build_corpus()
+{
+    Corpus corpus;
+    for (const Hand &roll : hand_combinations(5))
+    {
+        corpus.rolls.push_back(roll);
+        corpus.roll_vectors.push_back(roll.to_vector());
+    }
+    for (int r = 0; r < 7776; r++)
+    {
+        array<uint8_t, 5> roll;
+        for (int d = 0, rest = r; d < 5; d++, rest /= 6)
+        {
+            roll[d] = static_cast<uint8_t>(rest % 6 + 1);
+        }
+        corpus.ordered_rolls.emplace_back(roll.begin(), roll.end());
+        corpus.ordered_dice.add(roll);
+        corpus.ordered_counts.add(Hand(corpus.ordered_rolls.back()));
+    }
+    for (int num_kept = 0; num_kept < 5; num_kept++)
+    {
+        for (const Hand &kept_dice : hand_combinations(num_kept))
+        {
+            corpus.kept.push_back(kept_dice);
+            corpus.kept_vectors.push_back(kept_dice.to_vector());
+            for (const Hand &dice_rolls : hand_combinations(5 - num_kept))
+            {
+                corpus.turn_states.emplace_back(kept_dice, dice_rolls);
+            }
+        }
+    }
+
+    DiceSource dice_source(1);
+    for (int i = 0; i < 64; i++)
+    {
+        ScoreCard score_card;
+        const int num_filled = i % NUM_CATEGORIES;
+        for (int round = 1; score_card.get_fill_count(0) + score_card.get_fill_count(1) < num_filled; round++)
+        {
+            score_card = score_card.add_entry(round, round % 2 ? 0 : 1, Dice::roll_hand(5, dice_source));
+        }
+        corpus.score_cards.push_back(score_card);
+        corpus.serials.push_back(score_card.serialize(corpus.players));
+        corpus.binary_serials.emplace_back();
+        BinarySave::encode(score_card, 1, corpus.binary_serials.back().data());
+    }
+    return corpus;
+}
+
+
+// Struct to walk the positions of a corpus list round and round without a division per op
+struct Cursor
+{
+    const size_t size;
+    size_t position = 0;
+
+    explicit Cursor(const size_t size) : size(size)
+    {
+    }
+
+    size_t next()
+    {
+        const size_t current = position;
+        position = position + 1 == size ? 0 : position + 1;
+        return current;
+    }
+};
+
+
+// Struct to hold one benchmark: run(iterations) performs the operation that many times
+struct Benchmark
+{
+    string name;
+    function<void(uint64_t)> run;
+};
+
+// Struct to hold the measurement of one benchmark
+struct BenchmarkResult
+{
+    uint64_t iterations;
+    double ns_per_op;
+    double allocs_per_op;
+    double bytes_per_op;
+};
+
+
+/* *********************************************************************
+Function Name: verify_batch_scoring
+Purpose: To check the batch scoring kernel against get_score before timing it.
+Parameters:
+            corpus, a Corpus passed by reference. It holds every ordered roll.
+Return Value: true if both batch forms give get_score's score for every ordered roll and category.
+Algorithm:
+            1) Score every ordered roll in batch form, from its dice and from its face counts.
+            2) Compare every score with get_score on the roll's vector, reporting the first mismatch.
+Reference: none
+********************************************************************* */
+bool verify_batch_scoring(const Corpus &corpus)
+{
+    BatchScores from_dice;
+    BatchScores from_counts;
+    BatchScorer::score(corpus.ordered_dice, from_dice);
+    BatchScorer::score(corpus.ordered_counts, from_counts);
+
+    for (size_t r = 0; r < corpus.ordered_rolls.size(); r++)
+    {
+        for (int c = 0; c < NUM_CATEGORIES; c++)
+        {
+            const int expected = get_score(corpus.ordered_rolls[r], static_cast<Category>(c + 1));
+            if (from_dice.scores[c][r] != expected || from_counts.scores[c][r] != expected)
+            {
+                cerr << "Batch scoring of " << to_string_vector(corpus.ordered_rolls[r]) << " in "
+                     << CATEGORY_NAMES[static_cast<Category>(c + 1)] << " gives " << int(from_dice.scores[c][r])
+                     << " from dice and " << int(from_counts.scores[c][r]) << " from counts, get_score gives "
+                     << expected << endl;
+                return false;
+            }
+        }
+    }
+    cout << "Batch scoring (" << BatchScorer::get_instruction_set() << ") matches get_score on all "
+         << corpus.ordered_rolls.size() << " ordered rolls\n"
+         << endl;
+    return true;
+}
+
+
+/* *********************************************************************
+Function Name: get_benchmarks
+Purpose: To list the benchmarks of the scoring and strategy hot paths.
+Parameters:
+            corpus, a Corpus passed by reference. Every benchmark cycles through its inputs.
+Return Value: A vector of Benchmarks.
+Algorithm:
+            1) Wrap every measured call in a loop that cycles through the corpus inputs; one call is one op.
+Reference: none
+********************************************************************* */
+vector<Benchmark> get_benchmarks(const Corpus &corpus)
+{
+    const Corpus *c = &corpus;
+    const shared_ptr<Computer> computer = make_shared<Computer>();
+    vector<Benchmark> benchmarks;
+
+    benchmarks.push_back({"get_score/Hand", [c](const uint64_t n)
+                          {
+        Cursor input(c->rolls.size() * NUM_CATEGORIES);
+        for (uint64_t i = 0; i < n; i++)
+        {
+            const size_t k = input.next();
+            do_not_optimize(get_score(c->rolls[k / NUM_CATEGORIES], CATEGORIES[k % NUM_CATEGORIES]));
+        } }});
+    benchmarks.push_back({"get_score/vector", [c](const uint64_t n)
+                          {
+        Cursor input(c->roll_vectors.size() * NUM_CATEGORIES);
+        for (uint64_t i = 0; i < n; i++)
+        {
+            const size_t k = input.next();
+            do_not_optimize(get_score(c->roll_vectors[k / NUM_CATEGORIES], CATEGORIES[k % NUM_CATEGORIES]));
+        } }});
+    benchmarks.push_back({"get_score/vector (7776 rolls x 12)", [c](const uint64_t n)
+                          {
+        for (uint64_t i = 0; i < n; i++)
+        {
+            for (const vector<int> &roll : c->ordered_rolls)
+            {
+                for (const Category category : CATEGORIES)
+                {
+                    do_not_optimize(get_score(roll, category));
+                }
+            }
+        } }});
+    benchmarks.push_back({"BatchScorer::score/dice (7776 rolls)", [c](const uint64_t n)
+                          {
+        BatchScores scores;
+        for (uint64_t i = 0; i < n; i++)
+        {
+            BatchScorer::score(c->ordered_dice, scores);
+            do_not_optimize(scores.scores[NUM_CATEGORIES - 1][0]);
+        } }});
+    benchmarks.push_back({"BatchScorer::score/counts (7776 rolls)", [c](const uint64_t n)
+                          {
+        BatchScores scores;
+        for (uint64_t i = 0; i < n; i++)
+        {
+            BatchScorer::score(c->ordered_counts, scores);
+            do_not_optimize(scores.scores[NUM_CATEGORIES - 1][0]);
+        } }});
+    benchmarks.push_back({"get_applicable_categories/Hand", [c](const uint64_t n)
+                          {
+        Cursor roll(c->rolls.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(get_applicable_categories(c->rolls[roll.next()]));
+        } }});
+    benchmarks.push_back({"get_applicable_categories/vector", [c](const uint64_t n)
+                          {
+        Cursor roll(c->roll_vectors.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(get_applicable_categories(c->roll_vectors[roll.next()]));
+        } }});
+    benchmarks.push_back({"is_possible_category/Hand", [c](const uint64_t n)
+                          {
+        Cursor input(c->kept.size() * NUM_CATEGORIES);
+        for (uint64_t i = 0; i < n; i++)
+        {
+            const size_t k = input.next();
+            do_not_optimize(is_possible_category(c->kept[k / NUM_CATEGORIES], CATEGORIES[k % NUM_CATEGORIES]));
+        } }});
+    benchmarks.push_back({"is_possible_category/vector", [c](const uint64_t n)
+                          {
+        Cursor input(c->kept_vectors.size() * NUM_CATEGORIES);
+        for (uint64_t i = 0; i < n; i++)
+        {
+            const size_t k = input.next();
+            do_not_optimize(is_possible_category(c->kept_vectors[k / NUM_CATEGORIES], CATEGORIES[k % NUM_CATEGORIES]));
+        } }});
+    benchmarks.push_back({"dice_combinations", [](const uint64_t n)
+                          {
+        Cursor num_dice(5);
+        for (uint64_t i = 0; i < n; i++)
+        {
+            int sum = 0;
+            for (const DiceRoll roll : dice_combinations(static_cast<int>(num_dice.next()) + 1))
+            {
+                sum += roll[0];
+            }
+            do_not_optimize(sum);
+        } }});
+    benchmarks.push_back({"get_dice_permutation", [](const uint64_t n)
+                          {
+        Cursor num_dice(5);
+        for (uint64_t i = 0; i < n; i++)
+        {
+            int sum = 0;
+            for (const DiceRoll roll : get_dice_permutation(static_cast<int>(num_dice.next()) + 1))
+            {
+                sum += roll[0];
+            }
+            do_not_optimize(sum);
+        } }});
+    benchmarks.push_back({"Computer::generate_possible_final_rolls", [c](const uint64_t n)
+                          {
+        Cursor kept(c->kept.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(Computer::generate_possible_final_rolls(c->kept[kept.next()]));
+        } }});
+    benchmarks.push_back({"Computer::get_best_roll", [c](const uint64_t n)
+                          {
+        Cursor kept(c->kept.size());
+        Cursor score_card(c->score_cards.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(Computer::get_best_roll(c->score_cards[score_card.next()], c->kept[kept.next()]));
+        } }});
+    benchmarks.push_back({"Computer::get_dice_to_keep", [c, computer](const uint64_t n)
+                          {
+        Cursor state(c->turn_states.size());
+        Cursor score_card(c->score_cards.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            const pair<Hand, Hand> &turn_state = c->turn_states[state.next()];
+            do_not_optimize(computer->get_dice_to_keep(c->score_cards[score_card.next()], turn_state.second,
+                                                       turn_state.first, 1));
+        } }});
+    benchmarks.push_back({"Computer::wants_to_stand", [c, computer](const uint64_t n)
+                          {
+        Cursor state(c->turn_states.size());
+        Cursor score_card(c->score_cards.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            const pair<Hand, Hand> &turn_state = c->turn_states[state.next()];
+            do_not_optimize(computer->wants_to_stand(c->score_cards[score_card.next()], turn_state.first,
+                                                     turn_state.second, 1));
+        } }});
+    benchmarks.push_back({"Computer::get_target", [c, computer](const uint64_t n)
+                          {
+        Cursor kept(c->kept.size());
+        Cursor score_card(c->score_cards.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(computer->get_target(c->score_cards[score_card.next()], c->kept[kept.next()]));
+        } }});
+    benchmarks.push_back({"Computer::get_category_pursuits", [c, computer](const uint64_t n)
+                          {
+        Cursor kept(c->kept.size());
+        Cursor score_card(c->score_cards.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(computer->get_category_pursuits(c->score_cards[score_card.next()], c->kept[kept.next()]));
+        } }});
+    benchmarks.push_back({"GameEngine::play (one game)", [](const uint64_t n)
+                          {
+        const vector<shared_ptr<Player>> players = {make_shared<Computer>("Computer1"),
+                                                    make_shared<Computer>("Computer2")};
+        GameEngine engine(players, 1, false);
+        for (uint64_t i = 0; i < n; i++)
+        {
+            engine.seed(i % 1024 + 1);
+            do_not_optimize(engine.play());
+        } }});
+    benchmarks.push_back({"ScoreCard::add_entry", [c](const uint64_t n)
+                          {
+        Cursor roll(c->rolls.size());
+        Cursor score_card(c->score_cards.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(c->score_cards[score_card.next()].add_entry(1, 0, c->rolls[roll.next()]));
+        } }});
+    benchmarks.push_back({"ScoreCard::get_possible_categories", [c](const uint64_t n)
+                          {
+        Cursor kept(c->kept.size());
+        Cursor score_card(c->score_cards.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(c->score_cards[score_card.next()].get_possible_categories(c->kept[kept.next()]));
+        } }});
+    benchmarks.push_back({"ScoreCard::get_max_scoring_category", [c](const uint64_t n)
+                          {
+        Cursor roll(c->rolls.size());
+        Cursor score_card(c->score_cards.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(c->score_cards[score_card.next()].get_max_scoring_category(c->rolls[roll.next()]));
+        } }});
+    benchmarks.push_back({"ScoreCard::serialize", [c](const uint64_t n)
+                          {
+        Cursor score_card(c->score_cards.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(c->score_cards[score_card.next()].serialize(c->players));
+        } }});
+    benchmarks.push_back({"ScoreCard::deserialize", [c](const uint64_t n)
+                          {
+        Cursor serial(c->serials.size());
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(ScoreCard::deserialize(c->serials[serial.next()], c->players));
+        } }});
+    benchmarks.push_back({"BinarySave::encode", [c](const uint64_t n)
+                          {
+        Cursor score_card(c->score_cards.size());
+        array<uint8_t, BINARY_SAVE_SIZE> bytes;
+        for (uint64_t i = 0; i < n; i++)
+        {
+            BinarySave::encode(c->score_cards[score_card.next()], 1, bytes.data());
+            do_not_optimize(bytes);
+        } }});
+    benchmarks.push_back({"BinarySave::decode", [c](const uint64_t n)
+                          {
+        Cursor serial(c->binary_serials.size());
+        int round = 1;
+        for (uint64_t i = 0; i < n; i++)
+        {
+            do_not_optimize(BinarySave::decode(c->binary_serials[serial.next()].data(), BINARY_SAVE_SIZE, round));
+        } }});
+    return benchmarks;
+}
+
+
+/* *********************************************************************
+Function Name: measure
+Purpose: To time one benchmark and count its allocations.
+Parameters:
+            benchmark, a Benchmark passed by reference.
+            min_seconds, a double. It is the shortest run that counts as a measurement.
+Return Value: The BenchmarkResult.
+Algorithm:
+            1) Run one iteration to warm up caches and lazily built tables.
+            2) Run 1, 10, 100, ... iterations until a run takes at least min_seconds, sizing the next run
+               from the time of the last one.
+            3) Report the time, allocations and allocated bytes of the last run divided by its iterations.
+Reference: Google Benchmark's iteration scaling
+********************************************************************* */
+BenchmarkResult measure(const Benchmark &benchmark, const double min_seconds)
+{
+    benchmark.run(1);
+
+    uint64_t iterations = 1;
+    while (true)
+    {
+        AllocationTally allocations;
+        double seconds;
+        {
+            const AllocationScope allocation_scope(allocations);
+            const auto start = chrono::steady_clock::now();
+            benchmark.run(iterations);
+            seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        }
+
+        if (seconds >= min_seconds || iterations >= (1ull << 40))
+        {
+            const double ops = static_cast<double>(iterations);
+            return BenchmarkResult{iterations, seconds * 1e9 / ops, allocations.allocations / ops,
+                                   allocations.bytes / ops};
+        }
+
+        // Aim 40% past the minimum time, growing at most tenfold per step
+        const double scale = seconds > 0 ? 1.4 * min_seconds / seconds : 10;
+        iterations = max(iterations + 1, static_cast<uint64_t>(iterations * min(scale, 10.0)));
+    }
+}
+
+
+/* *********************************************************************
+Function Name: main
+Purpose: To run the microbenchmarks of the scoring and strategy hot paths.
+Parameters:
+            argc, argv: the command line. Supported options are
+                --filter <text>    only run benchmarks whose name contains text
+                --min-time <s>     shortest measured run of each benchmark in seconds (default 0.2)
+Return Value: 0 on success, 1 if the command line is invalid or batch scoring disagrees with get_score
+Algorithm:
+            1) Build the fixed input corpus and verify batch scoring against it.
+            2) Measure every selected benchmark and print its time, iterations, allocations and bytes per op.
+Reference: none
+********************************************************************* */
+int main(int argc, char *argv[])
+{
+    string filter;
+    double min_seconds = 0.2;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const string option = argv[i];
+        if (i + 1 >= argc)
+        {
+            cerr << "Missing value for " << option << endl;
+            return 1;
+        }
+        if (option == "--filter")
+        {
+            filter = argv[++i];
+        }
+        else if (option == "--min-time")
+        {
+            try
+            {
+                min_seconds = parse_seconds(option, argv[++i]);
+            }
+            catch (const invalid_argument &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else
+        {
+            cerr << "Unknown option " << option << endl;
+            return 1;
+        }
+    }
+
+    const Corpus corpus = build_corpus();
+    if (!verify_batch_scoring(corpus))
+    {
+        return 1;
+    }
+
+    cout << left << setw(42) << "Benchmark" << right << setw(14) << "Time" << setw(14) << "Iterations"
+         << setw(12) << "Allocs/op" << setw(12) << "Bytes/op" << endl;
+    cout << string(94, '-') << endl;
+    for (const Benchmark &benchmark : get_benchmarks(corpus))
+    {
+        if (benchmark.name.find(filter) == string::npos)
+        {
+            continue;
+        }
+        const BenchmarkResult result = measure(benchmark, min_seconds);
+        cout << left << setw(42) << benchmark.name << right << fixed << setprecision(1) << setw(11)
+             << result.ns_per_op << " ns" << setw(14) << result.iterations << setprecision(2) << setw(12)
+             << result.allocs_per_op << setprecision(0) << setw(12) << result.bytes_per_op << endl;
+    }
+    return 0;
+}
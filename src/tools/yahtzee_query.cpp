@@ -0,0 +1,253 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "../Computer.h"
+#include "../ReplayArchive.h"
+#include "../io_functions.h"
+
+// Struct to hold the aggregates computed over an archive
+struct ArchiveSummary
+{
+    uint64_t games = 0;
+
+    // Written records that failed ArchiveRecord::is_intact and were left out
+    uint64_t corrupt_games = 0;
+
+    // Games won by the player who went first and by the player who went second
+    uint64_t first_player_wins = 0;
+    uint64_t second_player_wins = 0;
+    uint64_t draws = 0;
+    array<uint64_t, 2> total_scores{};
+    uint64_t total_rounds = 0;
+
+    // Per category: games it was filled in, and its total points
+    array<uint64_t, NUM_CATEGORIES> fills{};
+    array<uint64_t, NUM_CATEGORIES> total_points{};
+};
+
+
+/* *********************************************************************
+Function Name: summarize
+Purpose: To compute the aggregates of every game in an archive.
+Parameters:
+            archive, a ReplayArchive passed by reference.
+Return Value: The ArchiveSummary of the archive.
+Algorithm:
+            1) Walk the mapped game records in order, skipping records that were never written and
+               counting the written ones that are not intact.
+            2) Read every category's points and winner from the packed scorecard, adding up both scores.
+            3) Count the game as a win of the first or second player to move, or a draw.
+Reference: none
+********************************************************************* */
+ArchiveSummary summarize(const ReplayArchive &archive)
+{
+    ArchiveSummary summary;
+    for (const ArchiveRecord &record : archive)
+    {
+        if (!(record.flags & ARCHIVE_GAME_PRESENT))
+        {
+            continue;
+        }
+        if (!record.is_intact())
+        {
+            summary.corrupt_games++;
+            continue;
+        }
+        summary.games++;
+        summary.total_rounds += record.rounds;
+
+        array<int, 2> scores{};
+        for (int c = 0; c < NUM_CATEGORIES; c++)
+        {
+            const Category category = static_cast<Category>(c + 1);
+            const int winner = record.get_winner(category);
+            if (winner >= 0)
+            {
+                const int points = record.get_points(category);
+                scores[winner] += points;
+                summary.fills[c]++;
+                summary.total_points[c] += points;
+            }
+        }
+        summary.total_scores[0] += scores[0];
+        summary.total_scores[1] += scores[1];
+
+        const int first = record.first_player;
+        if (scores[first] == scores[1 - first])
+        {
+            summary.draws++;
+        }
+        else if (scores[first] > scores[1 - first])
+        {
+            summary.first_player_wins++;
+        }
+        else
+        {
+            summary.second_player_wins++;
+        }
+    }
+    return summary;
+}
+
+
+/* *********************************************************************
+Function Name: show_summary
+Purpose: To print the aggregates of an archive.
+Parameters:
+            summary, an ArchiveSummary passed by reference.
+            seconds, a double. It is the time the scan took.
+Return Value: None
+Algorithm:
+            1) Print the game count and scan speed, the win rates by turn order and the mean scores.
+            2) Print, for each category, how often it was filled and its average points.
+Reference: none
+********************************************************************* */
+void show_summary(const ArchiveSummary &summary, const double seconds)
+{
+    const double games = static_cast<double>(summary.games);
+
+    cout << summary.games << " games scanned in " << fixed << setprecision(3) << seconds << " s ("
+         << setprecision(0) << games / seconds << " games/s)\n"
+         << endl;
+    if (summary.corrupt_games > 0)
+    {
+        cout << summary.corrupt_games << " corrupt games were skipped.\n"
+             << endl;
+    }
+    if (summary.games == 0)
+    {
+        return;
+    }
+
+    cout << setprecision(2);
+    cout << left << setw(20) << "First player wins" << right << setw(8) << 100.0 * summary.first_player_wins / games
+         << "%" << endl;
+    cout << left << setw(20) << "Second player wins" << right << setw(8) << 100.0 * summary.second_player_wins / games
+         << "%" << endl;
+    cout << left << setw(20) << "Draws" << right << setw(8) << 100.0 * summary.draws / games << "%\n"
+         << endl;
+
+    cout << "Mean score: player 1 " << summary.total_scores[0] / games << ", player 2 "
+         << summary.total_scores[1] / games << "; mean rounds " << summary.total_rounds / games << "\n"
+         << endl;
+
+    cout << left << setw(20) << "Category" << right << setw(10) << "Filled" << setw(10) << "Points" << endl;
+    for (const Category category : CATEGORIES)
+    {
+        const int c = static_cast<int>(category) - 1;
+        const double fills = static_cast<double>(summary.fills[c]);
+        cout << left << setw(20) << CATEGORY_NAMES[category] << right << setw(9) << 100.0 * fills / games << "%"
+             << setw(10) << (fills > 0 ? summary.total_points[c] / fills : 0) << endl;
+    }
+}
+
+
+/* *********************************************************************
+Function Name: show_game
+Purpose: To print one game of an archive.
+Parameters:
+            archive, a ReplayArchive passed by reference.
+            game, an unsigned integer. It is the game number.
+Return Value: None
+Algorithm:
+            1) Jump to the game's record; refuse it if it is not intact.
+            2) Print its seed, rounds, first player and scorecard.
+            3) Print its turn records, if the archive stored them.
+Reference: none
+********************************************************************* */
+void show_game(const ReplayArchive &archive, const uint64_t game)
+{
+    const ArchiveRecord &record = archive.get_game(game);
+    if (!(record.flags & ARCHIVE_GAME_PRESENT))
+    {
+        cout << "Game " << game << " was not written." << endl;
+        return;
+    }
+    if (!record.is_intact())
+    {
+        cout << "Game " << game << " is corrupt." << endl;
+        return;
+    }
+
+    const vector<shared_ptr<Player>> players = {make_shared<Computer>("Computer1"), make_shared<Computer>("Computer2")};
+    cout << "Game " << game << ": seed " << record.seed << ", " << record.rounds << " rounds, "
+         << players[record.first_player]->get_name() << " went first\n"
+         << endl;
+    cout << ReplayArchive::get_score_card(record).get_string(players) << endl;
+
+    static const char *const EVENT_NAMES[] = {"", "rolled", "kept", "stood on", "scored", "round end"};
+    JournalRecord turn_record{};
+    for (uint32_t i = 0; i < record.journal_count; i++)
+    {
+        if (!archive.get_turn_record(record, i, turn_record))
+        {
+            cout << "Turn record " << i << " is corrupt." << endl;
+            return;
+        }
+        cout << "Round " << turn_record.round << ": " << players[turn_record.player]->get_name() << " "
+             << EVENT_NAMES[static_cast<int>(turn_record.event)] << " " << to_string_hand(turn_record.dice);
+        if (turn_record.event == JournalEvent::Score && turn_record.category != 0)
+        {
+            cout << " for " << turn_record.points << " in "
+                 << CATEGORY_NAMES[static_cast<Category>(turn_record.category)];
+        }
+        cout << endl;
+    }
+}
+
+
+/* *********************************************************************
+Function Name: main
+Purpose: To query a replay archive written by yahtzee_sim --archive.
+Parameters:
+            argc, argv: the command line, yahtzee_query <archive> [--game <n>]
+                --game <n>  print game n instead of the aggregates of every game
+Return Value: 0 on success, 1 if the command line, the archive or the game number is invalid
+Algorithm:
+            1) Memory-map the archive.
+            2) Print the requested game, or scan every game and print the aggregates.
+Reference: none
+********************************************************************* */
+int main(int argc, char *argv[])
+{
+    if (argc != 2 && !(argc == 4 && string(argv[2]) == "--game"))
+    {
+        cerr << "Usage: yahtzee_query <archive> [--game <n>]" << endl;
+        return 1;
+    }
+
+    try
+    {
+        const ReplayArchive archive(argv[1]);
+        if (argc == 4)
+        {
+            show_game(archive, stoull(argv[3]));
+            return 0;
+        }
+
+        const auto start = chrono::steady_clock::now();
+        const ArchiveSummary summary = summarize(archive);
+        show_summary(summary, chrono::duration<double>(chrono::steady_clock::now() - start).count());
+    }
+    catch (const exception &error)
+    {
+        cerr << error.what() << endl;
+        return 1;
+    }
+    return 0;
+}
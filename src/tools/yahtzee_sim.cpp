@@ -0,0 +1,502 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// --stats counts allocations only in builds with -DYAHTZEE_COUNT_ALLOCATIONS, so ordinary runs keep the
+// default operator new instead of paying for a counter on every allocation
+#include "../AllocationStats.h"
+
+#include "../Computer.h"
+#include "../GameEngine.h"
+#include "../PolicyTable.h"
+#include "../ReplayArchive.h"
+#include "../ResultStore.h"
+#include "../ValueTable.h"
+#include "../Trace.h"
+#include "../WorkScheduler.h"
+
+// Number of games a worker buffers before writing them to the archive
+constexpr size_t ARCHIVE_BATCH_GAMES = 1024;
+
+
+// A Computer that counts the allocations of every decision the game engine asks it for.
+// wants_to_stand calls get_dice_to_keep, so those allocations are counted by both tallies.
+class CountingComputer : public Computer
+{
+public:
+    explicit CountingComputer(const string &name) : Computer(name)
+    {
+    }
+
+    AllocationTally stand_allocations;
+    AllocationTally keep_allocations;
+
+    bool wants_to_stand(const ScoreCard &score_card, const Hand &kept_dice, const Hand &dice_rolls,
+                        const int rolls_left) override
+    {
+        const AllocationScope allocation_scope(stand_allocations);
+        return Computer::wants_to_stand(score_card, kept_dice, dice_rolls, rolls_left);
+    }
+
+    Hand get_dice_to_keep(const ScoreCard &score_card, const Hand &dice_rolls, const Hand &kept_dice,
+                          const int rolls_left) override
+    {
+        const AllocationScope allocation_scope(keep_allocations);
+        return Computer::get_dice_to_keep(score_card, dice_rolls, kept_dice, rolls_left);
+    }
+};
+
+
+/* *********************************************************************
+Function Name: percentile
+Purpose: To read a percentile from a histogram.
+Parameters:
+            counts, an array of counts indexed by value.
+            total, an unsigned integer. It is the sum of the counts.
+            fraction, a double from 0 to 1.
+Return Value: The smallest value with at least fraction of the counts at or below it.
+Algorithm:
+            1) Walk the buckets, accumulating counts, until fraction * total is reached.
+Reference: none
+********************************************************************* */
+template <size_t N>
+int percentile(const array<uint64_t, N> &counts, const uint64_t total, const double fraction)
+{
+    const double target = fraction * static_cast<double>(total);
+    uint64_t seen = 0;
+    for (size_t value = 0; value < N; value++)
+    {
+        seen += counts[value];
+        if (seen > 0 && static_cast<double>(seen) >= target)
+        {
+            return static_cast<int>(value);
+        }
+    }
+    return static_cast<int>(N) - 1;
+}
+
+
+/* *********************************************************************
+Function Name: show_score_distribution
+Purpose: To print the summary of one score histogram.
+Parameters:
+            label, a string. It names the row.
+            counts, an array of counts indexed by score.
+            total, an unsigned integer. It is the number of games.
+Return Value: None
+Algorithm:
+            1) Compute the mean and standard deviation from the histogram.
+            2) Print them together with the minimum, 10th, 50th and 90th percentiles and the maximum.
+Reference: none
+********************************************************************* */
+void show_score_distribution(const string &label, const array<uint64_t, MAX_SCORE + 1> &counts, const uint64_t total)
+{
+    double sum = 0;
+    double sum_squares = 0;
+    for (int score = 0; score <= MAX_SCORE; score++)
+    {
+        sum += static_cast<double>(counts[score]) * score;
+        sum_squares += static_cast<double>(counts[score]) * score * score;
+    }
+    const double mean = sum / total;
+    const double deviation = sqrt(max(0.0, sum_squares / total - mean * mean));
+
+    cout << left << setw(12) << label << right << fixed << setprecision(2)
+         << setw(9) << mean << setw(9) << deviation
+         << setw(6) << percentile(counts, total, 0) << setw(6) << percentile(counts, total, 0.1)
+         << setw(6) << percentile(counts, total, 0.5) << setw(6) << percentile(counts, total, 0.9)
+         << setw(6) << percentile(counts, total, 1) << endl;
+}
+
+
+/* *********************************************************************
+Function Name: show_stats
+Purpose: To print the aggregated statistics of the simulation.
+Parameters:
+            store, the ResultStore holding every game.
+            players, the two players, in engine order.
+            seconds, a double. It is the wall-clock time of the simulation.
+            num_threads, an unsigned integer. It is the number of worker threads used.
+Return Value: None
+Algorithm:
+            1) Print throughput, win rates, draws and the first player's win rate.
+            2) Print the score distribution of each player, the best game and the rounds per game.
+            3) Print, for each category, its fill rate, mean and standard deviation of points, average
+               round and fill share.
+Reference: none
+********************************************************************* */
+void show_stats(const ResultStore &store, const vector<shared_ptr<Player>> &players, const double seconds,
+                const unsigned num_threads)
+{
+    const double games = static_cast<double>(store.size());
+
+    cout << store.size() << " games on " << num_threads << " threads in " << fixed << setprecision(2) << seconds
+         << " s (" << setprecision(0) << games / seconds << " games/s)\n"
+         << endl;
+
+    cout << setprecision(2);
+    for (int p = 0; p < 2; p++)
+    {
+        cout << left << setw(12) << players[p]->get_name() << " wins " << right << setw(6)
+             << 100.0 * store.count_wins(p) / games << "%" << endl;
+    }
+    cout << left << setw(12) << "Draws" << "      " << right << setw(6) << 100.0 * store.count_wins(-1) / games
+         << "%" << endl;
+    cout << left << setw(12) << "First player" << " wins " << right << setw(6)
+         << 100.0 * store.count_first_player_wins() / games << "%\n"
+         << endl;
+
+    cout << left << setw(12) << "Score" << right << setw(9) << "Mean" << setw(9) << "StdDev" << setw(6) << "Min"
+         << setw(6) << "P10" << setw(6) << "P50" << setw(6) << "P90" << setw(6) << "Max" << endl;
+    for (int p = 0; p < 2; p++)
+    {
+        show_score_distribution(players[p]->get_name(), store.get_score_histogram(p), store.size());
+    }
+    const pair<int, uint64_t> best_game = store.get_best_game();
+    cout << "Best game: " << best_game.first << " points (seed " << best_game.second << ")" << endl;
+
+    // The histogram caps long games at MAX_ROUNDS, so the mean comes from the rounds column itself
+    const array<uint64_t, MAX_ROUNDS + 1> round_counts = store.get_round_histogram();
+    cout << "\nRounds per game: mean " << store.get_round_moments().mean << ", P50 "
+         << percentile(round_counts, store.size(), 0.5) << ", P99 "
+         << percentile(round_counts, store.size(), 0.99) << "\n"
+         << endl;
+
+    cout << left << setw(20) << "Category" << right << setw(10) << "Filled" << setw(10) << "Points"
+         << setw(10) << "StdDev" << setw(10) << "Round" << setw(14) << players[0]->get_name() << "%" << endl;
+    for (const Category category : CATEGORIES)
+    {
+        const ColumnMoments points = store.get_points_moments(category);
+        const double fills = static_cast<double>(points.count);
+        cout << left << setw(20) << CATEGORY_NAMES[category] << right
+             << setw(9) << 100.0 * fills / games << "%"
+             << setw(10) << points.mean << setw(10) << sqrt(points.variance)
+             << setw(10) << store.get_fill_round_moments(category).mean
+             << setw(14) << (fills > 0 ? 100.0 * store.count_fills(category, 0) / fills : 0) << "%" << endl;
+    }
+}
+
+
+/* *********************************************************************
+Function Name: show_allocation_stats
+Purpose: To print how much the decision path allocates.
+Parameters:
+            stand, keep, the AllocationTallies of every wants_to_stand and get_dice_to_keep call.
+            turn, the AllocationTally of every turn the engines played.
+            games, an unsigned integer. It is the number of games played.
+Return Value: None
+Algorithm:
+            1) Print calls, allocations per call and bytes per call for each tally, then per game.
+Reference: none
+********************************************************************* */
+void show_allocation_stats(const AllocationTally &stand, const AllocationTally &keep, const AllocationTally &turn,
+                           const uint64_t games)
+{
+    cout << "\n"
+         << left << setw(28) << "Allocations" << right << setw(14) << "Calls" << setw(14) << "Allocs/call"
+         << setw(14) << "Bytes/call" << endl;
+    const pair<const char *, const AllocationTally *> rows[] = {{"Computer::wants_to_stand", &stand},
+                                                                {"Computer::get_dice_to_keep", &keep},
+                                                                {"Turn", &turn}};
+    for (const auto &[name, tally] : rows)
+    {
+        cout << left << setw(28) << name << right << setw(14) << tally->calls << fixed << setprecision(3)
+             << setw(14) << tally->get_allocations_per_call() << setw(14) << tally->get_bytes_per_call() << endl;
+    }
+    cout << left << setw(28) << "Game" << right << setw(14) << games << setw(14)
+         << static_cast<double>(turn.allocations) / games << setw(14) << static_cast<double>(turn.bytes) / games
+         << endl;
+}
+
+
+/* *********************************************************************
+Function Name: main
+Purpose: To play many seeded computer-vs-computer games on every core and report their statistics.
+Parameters:
+            argc, argv: the command line. Supported options are
+                --games <n>      number of games to play (default 100000)
+                --threads <n>    number of worker threads (default: one per hardware thread)
+                --seed <n>       seed of the first game; game i uses seed + i (default 1)
+                --policy <file>  memory-map a policy table made by tools/make_policy
+                --values <file>  memory-map a value table made by tools/make_values to choose the scored categories
+                --archive <file> write every finished game to a replay archive for tools/yahtzee_query
+                --archive-turns <file>  like --archive, but also store every roll, keep, stand and score
+                --stats          also report the allocations of every Computer decision and turn
+                                 (needs -DYAHTZEE_COUNT_ALLOCATIONS)
+                --trace <file>   write a Chrome trace of the last spans of every worker (needs -DYAHTZEE_TRACE)
+Return Value: 0 on success, 1 if the command line is invalid or the archive cannot be written
+Algorithm:
+            1) Parse the command line, load the policy and value tables if given and arrange for the trace
+               to be written at exit if requested.
+            2) Give every worker its own players, game engine and result chunk.
+            3) Distribute the games with the work-stealing scheduler; each worker reseeds its engine with
+               the game's seed, plays the game and appends it to its own chunk, handing the chunk to the
+               result store once it is full. When archiving, it also adds the game to its own batch and
+               writes the batch once it is full. The first archive error is kept and the remaining games
+               are skipped.
+            4) Hand over the last chunks, write the last batches and finish the archive; print the archive
+               error and return 1 if any of it failed.
+            5) Print the statistics reduced from the result store, and the allocation tallies of every
+               worker's players and engine with --stats.
+Reference: none
+********************************************************************* */
+int main(int argc, char *argv[])
+{
+    uint64_t num_games = 100000;
+    unsigned num_threads = max(1u, thread::hardware_concurrency());
+    uint64_t seed = 1;
+    string archive_file;
+    bool archive_turns = false;
+    bool show_allocations = false;
+    string trace_file;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const string option = argv[i];
+        if (option == "--stats")
+        {
+            show_allocations = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            cerr << "Missing value for " << option << endl;
+            return 1;
+        }
+        if (option == "--games")
+        {
+            try
+            {
+                num_games = parse_unsigned(option, argv[++i]);
+            }
+            catch (const invalid_argument &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else if (option == "--threads")
+        {
+            try
+            {
+                num_threads = max(1u, static_cast<unsigned>(parse_unsigned(option, argv[++i])));
+            }
+            catch (const invalid_argument &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else if (option == "--seed")
+        {
+            try
+            {
+                seed = parse_unsigned(option, argv[++i]);
+            }
+            catch (const invalid_argument &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else if (option == "--policy")
+        {
+            try
+            {
+                PolicyTable::load(argv[++i]);
+            }
+            catch (const runtime_error &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else if (option == "--values")
+        {
+            try
+            {
+                ValueTable::load(argv[++i]);
+            }
+            catch (const runtime_error &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else if (option == "--archive" || option == "--archive-turns")
+        {
+            archive_file = argv[++i];
+            archive_turns = option == "--archive-turns";
+        }
+        else if (option == "--trace")
+        {
+            trace_file = argv[++i];
+        }
+        else
+        {
+            cerr << "Unknown option " << option << endl;
+            return 1;
+        }
+    }
+    if (num_games == 0 || num_games > UINT32_MAX)
+    {
+        cerr << "--games must be between 1 and " << UINT32_MAX << endl;
+        return 1;
+    }
+    if (show_allocations && !counts_allocations())
+    {
+        cerr << "--stats needs a build with -DYAHTZEE_COUNT_ALLOCATIONS" << endl;
+        return 1;
+    }
+    if (!trace_file.empty())
+    {
+        if (!Trace::is_compiled_in())
+        {
+            cerr << "--trace needs a build with -DYAHTZEE_TRACE" << endl;
+            return 1;
+        }
+        Trace::write_at_exit(trace_file);
+    }
+
+    unique_ptr<ReplayArchiveWriter> archive;
+    if (!archive_file.empty())
+    {
+        try
+        {
+            archive = make_unique<ReplayArchiveWriter>(archive_file, num_games);
+        }
+        catch (const runtime_error &error)
+        {
+            cerr << error.what() << endl;
+            return 1;
+        }
+    }
+
+    ResultStore store;
+
+    // Every worker owns its players, engine, result chunk and archive batch
+    struct Worker
+    {
+        vector<shared_ptr<Player>> players;
+        GameEngine engine;
+        unique_ptr<ResultChunk> chunk;
+        ArchiveBatch batch;
+    };
+    vector<unique_ptr<Worker>> workers;
+    for (unsigned w = 0; w < num_threads; w++)
+    {
+        const vector<shared_ptr<Player>> players =
+            show_allocations ? vector<shared_ptr<Player>>{make_shared<CountingComputer>("Computer1"),
+                                                          make_shared<CountingComputer>("Computer2")}
+                             : vector<shared_ptr<Player>>{make_shared<Computer>("Computer1"),
+                                                          make_shared<Computer>("Computer2")};
+        workers.push_back(make_unique<Worker>(Worker{players, GameEngine(players, seed, archive_turns),
+                                                    make_unique<ResultChunk>(), ArchiveBatch()}));
+    }
+
+    // The first error of writing the archive; once set, the workers skip their remaining games
+    atomic<bool> archive_failed(false);
+    exception_ptr archive_error;
+
+    const auto start = chrono::steady_clock::now();
+    WorkScheduler::run(num_games, num_threads,
+                       [&workers, &store, &archive, &archive_failed, &archive_error, seed](const unsigned w,
+                                                                                           const uint32_t game)
+                       {
+        if (archive_failed.load(memory_order_relaxed))
+        {
+            return;
+        }
+        Worker &worker = *workers[w];
+        worker.engine.seed(seed + game);
+        const GameResult result = worker.engine.play();
+        worker.chunk->add(seed + game, result);
+        if (worker.chunk->is_full())
+        {
+            store.append(move(worker.chunk));
+            worker.chunk = make_unique<ResultChunk>();
+        }
+        if (archive != nullptr)
+        {
+            try
+            {
+                ReplayArchive::add_game(worker.batch, game, seed + game, result);
+                if (worker.batch.records.size() >= ARCHIVE_BATCH_GAMES)
+                {
+                    archive->write(worker.batch);
+                }
+            }
+            catch (...)
+            {
+                // Only the first failing worker stores its error; the join publishes it
+                if (!archive_failed.exchange(true))
+                {
+                    archive_error = current_exception();
+                }
+            }
+        } });
+    for (const unique_ptr<Worker> &worker : workers)
+    {
+        store.append(move(worker->chunk));
+    }
+    if (archive != nullptr)
+    {
+        try
+        {
+            if (archive_error)
+            {
+                rethrow_exception(archive_error);
+            }
+            for (const unique_ptr<Worker> &worker : workers)
+            {
+                archive->write(worker->batch);
+            }
+            archive->finish();
+        }
+        catch (const exception &error)
+        {
+            cerr << error.what() << endl;
+            return 1;
+        }
+    }
+    const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    show_stats(store, workers[0]->players, seconds, num_threads);
+
+    if (show_allocations)
+    {
+        AllocationTally stand;
+        AllocationTally keep;
+        AllocationTally turn;
+        for (const unique_ptr<Worker> &worker : workers)
+        {
+            for (const shared_ptr<Player> &player : worker->players)
+            {
+                const CountingComputer &computer = static_cast<const CountingComputer &>(*player);
+                stand.merge(computer.stand_allocations);
+                keep.merge(computer.keep_allocations);
+            }
+            turn.merge(worker->engine.get_turn_allocations());
+        }
+        show_allocation_stats(stand, keep, turn, num_games);
+    }
+    return 0;
+}
@@ -0,0 +1,296 @@
+/*
+************************************************************
+* Name:  Samman Bhetwal                                    *
+* Project:  1 yahtzee                                      *
+* Class:  CMPS-366                                         *
+* Date:  10/26/2024                                        *
+*****************************************************************
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Computer.h"
+#include "../GameEngine.h"
+#include "../PolicyTable.h"
+#include "../WorkScheduler.h"
+
+// A Computer that times every call of get_dice_to_keep; each worker owns its own, so the samples
+// are collected without any sharing
+class TimedComputer : public Computer
+{
+public:
+    explicit TimedComputer(const string &name) : Computer(name)
+    {
+    }
+
+    // Latency of every get_dice_to_keep call, in nanoseconds
+    vector<uint32_t> latencies;
+
+    Hand get_dice_to_keep(const ScoreCard &score_card, const Hand &dice_rolls, const Hand &kept_dice,
+                          const int rolls_left) override
+    {
+        const auto start = chrono::steady_clock::now();
+        const Hand dice_to_keep = Computer::get_dice_to_keep(score_card, dice_rolls, kept_dice, rolls_left);
+        const auto nanoseconds = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start);
+        latencies.push_back(static_cast<uint32_t>(min<int64_t>(nanoseconds.count(), UINT32_MAX)));
+        return dice_to_keep;
+    }
+};
+
+// Struct to hold the measurement of one thread count
+struct ThroughputRun
+{
+    unsigned threads;
+    double seconds;
+    double games_per_second;
+
+    // Latency of get_dice_to_keep in nanoseconds
+    uint64_t decisions;
+    uint32_t p50;
+    uint32_t p99;
+    double mean;
+};
+
+
+/* *********************************************************************
+Function Name: run_games
+Purpose: To play the fixed seed set on some number of threads and measure it.
+Parameters:
+            num_games, an unsigned integer. It is the number of games; game i uses seed + i.
+            seed, an unsigned integer. It is the seed of the first game.
+            num_threads, an unsigned integer. It is the number of worker threads.
+Return Value: The ThroughputRun.
+Algorithm:
+            1) Give every worker two timed Computers and a headless game engine.
+            2) Play every game with the work-stealing scheduler and time the whole run.
+            3) Merge the workers' get_dice_to_keep latencies and read their mean, 50th and 99th percentiles.
+Reference: none
+********************************************************************* */
+ThroughputRun run_games(const uint64_t num_games, const uint64_t seed, const unsigned num_threads)
+{
+    struct Worker
+    {
+        shared_ptr<TimedComputer> first;
+        shared_ptr<TimedComputer> second;
+        GameEngine engine;
+    };
+    vector<unique_ptr<Worker>> workers;
+    for (unsigned w = 0; w < num_threads; w++)
+    {
+        const auto first = make_shared<TimedComputer>("Computer1");
+        const auto second = make_shared<TimedComputer>("Computer2");
+        workers.push_back(make_unique<Worker>(Worker{first, second, GameEngine({first, second}, seed, false)}));
+    }
+
+    const auto start = chrono::steady_clock::now();
+    WorkScheduler::run(num_games, num_threads, [&workers, seed](const unsigned w, const uint32_t game)
+                       {
+        Worker &worker = *workers[w];
+        worker.engine.seed(seed + game);
+        worker.engine.play(); });
+    const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<uint32_t> latencies;
+    for (const unique_ptr<Worker> &worker : workers)
+    {
+        latencies.insert(latencies.end(), worker->first->latencies.begin(), worker->first->latencies.end());
+        latencies.insert(latencies.end(), worker->second->latencies.begin(), worker->second->latencies.end());
+    }
+
+    ThroughputRun run{num_threads, seconds, num_games / seconds, latencies.size(), 0, 0, 0};
+    if (!latencies.empty())
+    {
+        double total = 0;
+        for (const uint32_t latency : latencies)
+        {
+            total += latency;
+        }
+        run.mean = total / latencies.size();
+        nth_element(latencies.begin(), latencies.begin() + latencies.size() / 2, latencies.end());
+        run.p50 = latencies[latencies.size() / 2];
+        nth_element(latencies.begin(), latencies.begin() + latencies.size() * 99 / 100, latencies.end());
+        run.p99 = latencies[latencies.size() * 99 / 100];
+    }
+    return run;
+}
+
+
+/* *********************************************************************
+Function Name: write_json
+Purpose: To write the measurements in a machine-readable form for tracking over time.
+Parameters:
+            out, an ostream passed by reference. It receives the JSON document.
+            runs, the ThroughputRuns, the first one on a single thread.
+            num_games, seed: the seed set that was played.
+            policy, a boolean. It is true if a policy table was loaded.
+Return Value: None
+Algorithm:
+            1) Write the seed set, then one object per thread count with its throughput, its scaling
+               over the single-thread run and its decision latencies.
+Reference: none
+********************************************************************* */
+void write_json(ostream &out, const vector<ThroughputRun> &runs, const uint64_t num_games, const uint64_t seed,
+                const bool policy)
+{
+    out << fixed << setprecision(3);
+    out << "{\n"
+        << "  \"benchmark\": \"yahtzee_throughput\",\n"
+        << "  \"games\": " << num_games << ",\n"
+        << "  \"seed\": " << seed << ",\n"
+        << "  \"policy\": " << (policy ? "true" : "false") << ",\n"
+        << "  \"runs\": [\n";
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        const ThroughputRun &run = runs[i];
+        out << "    {\"threads\": " << run.threads << ", \"seconds\": " << run.seconds
+            << ", \"games_per_second\": " << run.games_per_second
+            << ", \"games_per_second_per_thread\": " << run.games_per_second / run.threads
+            << ", \"scaling\": " << run.games_per_second / runs[0].games_per_second
+            << ", \"get_dice_to_keep_ns\": {\"calls\": " << run.decisions << ", \"mean\": " << run.mean
+            << ", \"p50\": " << run.p50 << ", \"p99\": " << run.p99 << "}}" << (i + 1 < runs.size() ? "," : "")
+            << "\n";
+    }
+    out << "  ]\n"
+        << "}" << endl;
+}
+
+
+/* *********************************************************************
+Function Name: main
+Purpose: To measure how many full computer-vs-computer games the engine completes per second, on one
+         core and on every core.
+Parameters:
+            argc, argv: the command line. Supported options are
+                --games <n>      number of games in the seed set (default 20000)
+                --seed <n>       seed of the first game; game i uses seed + i (default 1)
+                --threads <n>    highest thread count to measure (default: one per hardware thread)
+                --policy <file>  memory-map a policy table made by tools/make_policy
+                --json <file>    also write the results as JSON
+Return Value: 0 on success, 1 if the command line is invalid or the JSON file cannot be written
+Algorithm:
+            1) Parse the command line and load the policy table if given.
+            2) Play the same seed set on 1, 2, 4, ... threads up to the highest thread count.
+            3) Print games/s, games/s per thread, scaling and get_dice_to_keep latency for each run.
+            4) Write the JSON file if requested.
+Reference: none
+********************************************************************* */
+int main(int argc, char *argv[])
+{
+    uint64_t num_games = 20000;
+    uint64_t seed = 1;
+    unsigned max_threads = max(1u, thread::hardware_concurrency());
+    string json_file;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const string option = argv[i];
+        if (i + 1 >= argc)
+        {
+            cerr << "Missing value for " << option << endl;
+            return 1;
+        }
+        if (option == "--games")
+        {
+            try
+            {
+                num_games = parse_unsigned(option, argv[++i]);
+            }
+            catch (const invalid_argument &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else if (option == "--seed")
+        {
+            try
+            {
+                seed = parse_unsigned(option, argv[++i]);
+            }
+            catch (const invalid_argument &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else if (option == "--threads")
+        {
+            try
+            {
+                max_threads = max(1u, static_cast<unsigned>(parse_unsigned(option, argv[++i])));
+            }
+            catch (const invalid_argument &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else if (option == "--policy")
+        {
+            try
+            {
+                PolicyTable::load(argv[++i]);
+            }
+            catch (const runtime_error &error)
+            {
+                cerr << error.what() << endl;
+                return 1;
+            }
+        }
+        else if (option == "--json")
+        {
+            json_file = argv[++i];
+        }
+        else
+        {
+            cerr << "Unknown option " << option << endl;
+            return 1;
+        }
+    }
+    if (num_games == 0 || num_games > UINT32_MAX)
+    {
+        cerr << "--games must be between 1 and " << UINT32_MAX << endl;
+        return 1;
+    }
+
+    vector<unsigned> thread_counts;
+    for (unsigned threads = 1; threads < max_threads; threads *= 2)
+    {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    cout << left << setw(10) << "Threads" << right << setw(12) << "Games/s" << setw(16) << "Games/s/thread"
+         << setw(10) << "Scaling" << setw(12) << "Keep p50" << setw(12) << "Keep p99" << endl;
+    vector<ThroughputRun> runs;
+    for (const unsigned threads : thread_counts)
+    {
+        runs.push_back(run_games(num_games, seed, threads));
+        const ThroughputRun &run = runs.back();
+        cout << left << setw(10) << run.threads << right << fixed << setprecision(0) << setw(12)
+             << run.games_per_second << setw(16) << run.games_per_second / run.threads << setprecision(2)
+             << setw(10) << run.games_per_second / runs[0].games_per_second << setw(9) << run.p50 << " ns"
+             << setw(9) << run.p99 << " ns" << endl;
+    }
+
+    if (!json_file.empty())
+    {
+        ofstream file(json_file);
+        write_json(file, runs, num_games, seed, PolicyTable::loaded() != nullptr);
+        if (!file)
+        {
+            cerr << "Could not write " << json_file << endl;
+            return 1;
+        }
+    }
+    return 0;
+}